@@ -8,8 +8,10 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <queue>
 #include <random>
 #include <string>
+#include <vector>
 #include <benchmark/benchmark.h>
 #include <vista/circular_view.hpp>
 #include <vista/algorithm.hpp>
@@ -142,4 +144,53 @@ BENCHMARK_TEMPLATE(vista_push_pop_heap_string, 64);
 BENCHMARK_TEMPLATE(vista_push_pop_heap_string, 256);
 BENCHMARK_TEMPLATE(vista_push_pop_heap_string, 1024);
 
+// Pop and push on a full heap, as with a timer queue in steady state
+
+template <std::size_t Arity>
+void vista_pop_push_heap_arity(benchmark::State& state)
+{
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<int> distribution;
+
+    std::vector<int> heap;
+    for (std::size_t i = 0; i < amount; ++i)
+    {
+        heap.push_back(distribution(generator));
+        vista::push_heap<false, Arity>(heap.begin(), heap.end(), std::less<int>());
+    }
+
+    for (auto _ : state)
+    {
+        vista::pop_heap<false, Arity>(heap.begin(), heap.end(), std::less<int>());
+        heap.back() = distribution(generator);
+        vista::push_heap<false, Arity>(heap.begin(), heap.end(), std::less<int>());
+    }
+}
+
+BENCHMARK_TEMPLATE(vista_pop_push_heap_arity, 2)->RangeMultiplier(10)->Range(10000, 1000000);
+BENCHMARK_TEMPLATE(vista_pop_push_heap_arity, 4)->RangeMultiplier(10)->Range(10000, 1000000);
+BENCHMARK_TEMPLATE(vista_pop_push_heap_arity, 8)->RangeMultiplier(10)->Range(10000, 1000000);
+
+void std_pop_push_priority_queue(benchmark::State& state)
+{
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<int> distribution;
+
+    std::priority_queue<int> heap;
+    for (std::size_t i = 0; i < amount; ++i)
+    {
+        heap.push(distribution(generator));
+    }
+
+    for (auto _ : state)
+    {
+        heap.pop();
+        heap.push(distribution(generator));
+    }
+}
+
+BENCHMARK(std_pop_push_priority_queue)->RangeMultiplier(10)->Range(10000, 1000000);
+
 BENCHMARK_MAIN();
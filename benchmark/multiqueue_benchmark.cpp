@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <vista/priority_view.hpp>
+#include "multiqueue.hpp"
+
+// Concurrent hold model: each thread removes an early event and inserts a
+// later event, so the number of queued events stays constant.
+//
+// Both queues are seeded with the same events, and are rebuilt by the first
+// thread before each run so every thread count starts from the same state.
+
+constexpr std::size_t amount = 100000;
+
+template <typename Queue>
+void seed(Queue& queue)
+{
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<std::uint64_t> delay(0, 1 << 20);
+    for (std::size_t i = 0; i < amount; ++i)
+    {
+        queue.push(delay(generator));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Single priority view guarded by mutex
+
+struct locked_queue
+{
+    locked_queue()
+        : storage(amount),
+          heap(storage.data(), storage.size())
+    {
+    }
+
+    bool push(std::uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (heap.full())
+            return false;
+        heap.push(value);
+        return true;
+    }
+
+    bool try_pop(std::uint64_t& value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (heap.empty())
+            return false;
+        value = heap.top();
+        heap.pop();
+        return true;
+    }
+
+    std::mutex mutex;
+    std::vector<std::uint64_t> storage;
+    vista::priority_view<std::uint64_t, vista::dynamic_extent, std::greater<std::uint64_t>> heap;
+};
+
+//-----------------------------------------------------------------------------
+// MultiQueue with two shards per thread
+//
+// Shards have room for twice their share of the events, so random insertion
+// does not fill any shard.
+
+template <std::size_t Threads>
+using multiqueue_type = vista::priority::example::multiqueue<std::uint64_t,
+                                                             2 * Threads,
+                                                             2 * amount / (2 * Threads),
+                                                             std::greater<std::uint64_t>>;
+
+//-----------------------------------------------------------------------------
+
+template <typename Queue>
+void queue_hold(benchmark::State& state)
+{
+    static std::unique_ptr<Queue> queue;
+    if (state.thread_index() == 0)
+    {
+        // Other threads wait for the first thread before the loop starts
+        queue.reset(new Queue);
+        seed(*queue);
+    }
+    std::default_random_engine generator(state.thread_index() + 1);
+    std::uniform_int_distribution<std::uint64_t> delay(0, 1 << 20);
+
+    std::uint64_t now = 0;
+    for (auto _ : state)
+    {
+        if (!queue->try_pop(now) || !queue->push(now + delay(generator)))
+        {
+            state.SkipWithError("Queue underflow or overflow");
+            break;
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(queue_hold, locked_queue)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(queue_hold, multiqueue_type<1>)->Threads(1)->UseRealTime();
+BENCHMARK_TEMPLATE(queue_hold, multiqueue_type<2>)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(queue_hold, multiqueue_type<4>)->Threads(4)->UseRealTime();
+BENCHMARK_TEMPLATE(queue_hold, multiqueue_type<8>)->Threads(8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <vista/priority_view.hpp>
+#include <vista/radix_priority_view.hpp>
+
+// Hold model: remove the earliest event and insert a later event.
+
+void priority_view_hold(benchmark::State& state)
+{
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<std::uint64_t> delay(0, 1 << 20);
+
+    std::vector<std::uint64_t> storage(amount);
+    vista::priority_view<std::uint64_t, vista::dynamic_extent, std::greater<std::uint64_t>> heap(storage.data(), storage.size());
+    for (std::size_t i = 0; i < amount; ++i)
+    {
+        heap.push(delay(generator));
+    }
+
+    for (auto _ : state)
+    {
+        const auto now = heap.top();
+        heap.pop();
+        heap.push(now + delay(generator));
+    }
+}
+
+BENCHMARK(priority_view_hold)->RangeMultiplier(10)->Range(1000, 1000000);
+
+void radix_priority_view_hold(benchmark::State& state)
+{
+    using view_type = vista::radix_priority_view<std::uint64_t, std::uint64_t>;
+
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<std::uint64_t> delay(0, 1 << 20);
+
+    std::vector<view_type::node_type> storage(amount);
+    view_type heap(storage.data(), storage.size());
+    for (std::size_t i = 0; i < amount; ++i)
+    {
+        heap.push(delay(generator), i);
+    }
+
+    for (auto _ : state)
+    {
+        const auto now = heap.top().first;
+        heap.pop();
+        heap.push(now + delay(generator), now);
+    }
+}
+
+BENCHMARK(radix_priority_view_hold)->RangeMultiplier(10)->Range(1000, 1000000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <vista/indexed_priority_view.hpp>
+#include "timing_wheel.hpp"
+
+// Compares the timing wheel example with an indexed heap of expiry times.
+
+using time_type = std::int64_t;
+using wheel_type = vista::circular::example::timing_wheel<4, 8>;
+using timer = vista::circular::example::timer;
+using heap_type = vista::indexed_priority_view<time_type, vista::dynamic_extent, std::greater<time_type>>;
+
+constexpr time_type max_delay = 1 << 16;
+
+struct heap_storage
+{
+    explicit heap_storage(std::size_t amount)
+        : values(amount),
+          indices(2 * amount),
+          heap(values.data(), indices.data(), amount)
+    {
+    }
+
+    std::vector<time_type> values;
+    std::vector<std::size_t> indices;
+    heap_type heap;
+};
+
+// Cancel and schedule a random timer
+
+void timing_wheel_reschedule(benchmark::State& state)
+{
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<std::size_t> which(0, amount - 1);
+    std::uniform_int_distribution<time_type> delay(1, max_delay);
+
+    std::unique_ptr<wheel_type> wheel(new wheel_type);
+    std::vector<timer> timers(amount);
+    for (auto& entry : timers)
+    {
+        wheel->schedule(entry, delay(generator));
+    }
+
+    for (auto _ : state)
+    {
+        auto& entry = timers[which(generator)];
+        wheel->cancel(entry);
+        wheel->schedule(entry, delay(generator));
+    }
+}
+
+BENCHMARK(timing_wheel_reschedule)->RangeMultiplier(10)->Range(10000, 10000000);
+
+void heap_reschedule(benchmark::State& state)
+{
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<std::size_t> which(0, amount - 1);
+    std::uniform_int_distribution<time_type> delay(1, max_delay);
+
+    heap_storage storage(amount);
+    auto& heap = storage.heap;
+    for (std::size_t handle = 0; handle < amount; ++handle)
+    {
+        heap.push(handle, delay(generator));
+    }
+
+    for (auto _ : state)
+    {
+        const auto handle = which(generator);
+        heap.erase(handle);
+        heap.push(handle, delay(generator));
+    }
+}
+
+BENCHMARK(heap_reschedule)->RangeMultiplier(10)->Range(10000, 10000000);
+
+// Advance one tick and reschedule the expired timers
+
+void timing_wheel_advance(benchmark::State& state)
+{
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<time_type> delay(1, max_delay);
+
+    std::unique_ptr<wheel_type> wheel(new wheel_type);
+    std::vector<timer> timers(amount);
+    for (auto& entry : timers)
+    {
+        wheel->schedule(entry, delay(generator));
+    }
+
+    std::size_t fired = 0;
+    for (auto _ : state)
+    {
+        fired += wheel->advance(wheel->now() + 1, [&] (timer& entry) {
+            wheel->schedule(entry, wheel->now() + delay(generator));
+        });
+    }
+    state.SetItemsProcessed(fired);
+}
+
+BENCHMARK(timing_wheel_advance)->RangeMultiplier(10)->Range(10000, 10000000);
+
+void heap_advance(benchmark::State& state)
+{
+    const auto amount = std::size_t(state.range(0));
+    std::default_random_engine generator(1);
+    std::uniform_int_distribution<time_type> delay(1, max_delay);
+
+    heap_storage storage(amount);
+    auto& heap = storage.heap;
+    for (std::size_t handle = 0; handle < amount; ++handle)
+    {
+        heap.push(handle, delay(generator));
+    }
+
+    time_type now = 0;
+    std::size_t fired = 0;
+    for (auto _ : state)
+    {
+        ++now;
+        while (heap.top() <= now)
+        {
+            heap.update(heap.top_handle(), now + delay(generator));
+            ++fired;
+        }
+    }
+    state.SetItemsProcessed(fired);
+}
+
+BENCHMARK(heap_advance)->RangeMultiplier(10)->Range(10000, 10000000);
+
+BENCHMARK_MAIN();
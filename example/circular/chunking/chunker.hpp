@@ -0,0 +1,303 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_CHUNKER_HPP
+#define VISTA_CIRCULAR_EXAMPLE_CHUNKER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vista/circular_array.hpp>
+#include <vista/span.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Rolling hash over the most recent W bytes.
+//
+// Uses the cyclic polynomial hash (Buzhash) where each byte is mapped to a
+// random word through a precomputed table. The hash of the window is the XOR
+// of the table entries of its bytes, each rotated by its distance from the
+// end of the window.
+//
+// The window is kept in a circular array, so the outgoing byte is available
+// when the window is full. Each update takes constant time regardless of the
+// window size.
+
+template <std::size_t W>
+class rolling_hash
+{
+    static_assert(W > 0, "W must be greater than zero");
+
+public:
+    using value_type = std::uint8_t;
+    using hash_type = std::uint32_t;
+    using size_type = std::size_t;
+
+    static constexpr size_type window_size = W;
+
+    //! @brief Returns hash of the current window.
+
+    hash_type value() const noexcept
+    {
+        return hash;
+    }
+
+    //! @brief Returns the number of bytes in the current window.
+
+    size_type size() const noexcept
+    {
+        return window.size();
+    }
+
+    //! @brief Checks if the window is full.
+
+    bool full() const noexcept
+    {
+        return window.full();
+    }
+
+    //! @brief Clears the window.
+
+    void clear() noexcept
+    {
+        window.clear();
+        hash = 0;
+    }
+
+    //! @brief Appends byte to window.
+    //!
+    //! The oldest byte leaves the window when it is full.
+
+    hash_type push_back(value_type input) noexcept
+    {
+        const auto& entries = table();
+        hash = rotate(hash, 1) ^ entries[input];
+        if (window.full())
+        {
+            // The outgoing byte has been rotated W times since it was added
+            hash ^= rotate(entries[window.front()], W);
+        }
+        window.push_back(input);
+        return hash;
+    }
+
+    //! @brief Appends bytes to window.
+
+    hash_type push_back(span<const value_type> input) noexcept
+    {
+        push_back_until(input, [] (hash_type) { return false; });
+        return hash;
+    }
+
+    //! @brief Appends bytes to window until predicate is satisfied.
+    //!
+    //! The @c predicate(hash) is evaluated after each appended byte. Returns
+    //! the number of bytes appended, including the byte that satisfied the
+    //! predicate.
+    //!
+    //! Outgoing bytes are read from the input once the first W bytes have
+    //! been appended, and only the last W appended bytes are copied into the
+    //! window.
+
+    template <typename Predicate>
+    size_type push_back_until(span<const value_type> input, Predicate&& predicate)
+    {
+        const auto& entries = table();
+        const value_type *data = input.data();
+        const size_type size = input.size();
+        const size_type before = window.size();
+        size_type k = 0;
+        bool found = false;
+        // Outgoing bytes are in the window
+        for (const size_type head = std::min(size, W); k < head; ++k)
+        {
+            hash = rotate(hash, 1) ^ entries[data[k]];
+            if (before + k >= W)
+            {
+                hash ^= rotate(entries[window[before + k - W]], W);
+            }
+            if (predicate(hash))
+            {
+                found = true;
+                ++k;
+                break;
+            }
+        }
+        // Outgoing bytes are in the input
+        if (!found)
+        {
+            for (; k < size; ++k)
+            {
+                hash = rotate(hash, 1) ^ entries[data[k]] ^ rotate(entries[data[k - W]], W);
+                if (predicate(hash))
+                {
+                    ++k;
+                    break;
+                }
+            }
+        }
+        for (size_type j = k - std::min(k, W); j < k; ++j)
+        {
+            window.push_back(data[j]);
+        }
+        return k;
+    }
+
+    //! @brief Returns the random word that each byte is mapped to.
+
+    static const std::array<hash_type, 256>& table() noexcept
+    {
+        static const std::array<hash_type, 256> entries = make_table();
+        return entries;
+    }
+
+private:
+    static constexpr hash_type rotate(hash_type value, size_type count) noexcept
+    {
+        return ((count % 32) == 0)
+            ? value
+            : hash_type((value << (count % 32)) | (value >> (32 - count % 32)));
+    }
+
+    static std::array<hash_type, 256> make_table() noexcept
+    {
+        // Splitmix64 generator with fixed seed for reproducible hashes
+        std::array<hash_type, 256> result;
+        std::uint64_t state = 0;
+        for (auto& entry : result)
+        {
+            state += 0x9E3779B97F4A7C15ULL;
+            std::uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            entry = hash_type((z ^ (z >> 31)) >> 32);
+        }
+        return result;
+    }
+
+private:
+    circular_array<value_type, W> window;
+    hash_type hash = 0;
+};
+
+template <std::size_t W>
+constexpr std::size_t rolling_hash<W>::window_size;
+
+// Content-defined chunking of a byte stream.
+//
+// A chunk boundary is placed after a byte where the rolling hash of the
+// preceding W bytes has its lowest bits cleared. Boundaries therefore depend
+// on the local content only, so inserting or removing bytes in a stream only
+// changes the chunks near the modification. This is used for deduplication.
+//
+// Chunks are no smaller than the minimum size, and are cut at the maximum
+// size if no boundary is found. The rolling hash is restarted at each chunk
+// boundary, and the bytes that cannot affect the hash before the minimum size
+// is reached are skipped without being hashed.
+
+template <std::size_t W>
+class chunker
+{
+public:
+    using value_type = std::uint8_t;
+    using size_type = std::size_t;
+    using hash_type = typename rolling_hash<W>::hash_type;
+
+    //! @brief Creates chunker.
+    //!
+    //! The average chunk size is approximately min_size + 2^mask_bits.
+    //!
+    //! @pre W <= min_size <= max_size
+    //! @pre mask_bits < 32
+
+    chunker(size_type min_size, size_type max_size, unsigned mask_bits) noexcept
+        : min_size(min_size),
+          max_size(max_size),
+          mask((hash_type(1) << mask_bits) - 1)
+    {
+        assert(W <= min_size);
+        assert(min_size <= max_size);
+        assert(mask_bits < 32);
+    }
+
+    //! @brief Returns the number of bytes in the current unfinished chunk.
+
+    size_type size() const noexcept
+    {
+        return length;
+    }
+
+    //! @brief Appends bytes to the stream.
+    //!
+    //! Calls @c function(size) with the size of each completed chunk in the
+    //! order they are completed. Returns the number of completed chunks.
+
+    template <typename Function>
+    size_type push_back(span<const value_type> input, Function&& function)
+    {
+        size_type result = 0;
+        const value_type *first = input.data();
+        const value_type *const last = first + input.size();
+        while (first != last)
+        {
+            // Skip bytes that leave the window before the minimum size
+            const size_type skip_until = min_size - W;
+            if (length < skip_until)
+            {
+                const auto skip = std::min<size_type>(skip_until - length, size_type(last - first));
+                length += skip;
+                first += skip;
+                continue;
+            }
+            // Fill the window until the byte before the minimum size
+            if (length + 1 < min_size)
+            {
+                const auto fill = std::min<size_type>(min_size - 1 - length, size_type(last - first));
+                hasher.push_back(span<const value_type>(first, fill));
+                length += fill;
+                first += fill;
+                continue;
+            }
+            // Hash bytes until a boundary, the maximum size, or the end of input
+            const auto limit = std::min<size_type>(max_size - length, size_type(last - first));
+            const auto count = hasher.push_back_until(span<const value_type>(first, limit),
+                                                      [this] (hash_type hash) { return (hash & mask) == 0; });
+            length += count;
+            first += count;
+            if (((hasher.value() & mask) == 0) || (length == max_size))
+            {
+                function(length);
+                ++result;
+                length = 0;
+                hasher.clear();
+            }
+        }
+        return result;
+    }
+
+private:
+    const size_type min_size;
+    const size_type max_size;
+    const hash_type mask;
+    rolling_hash<W> hasher;
+    size_type length = 0;
+};
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_CHUNKER_HPP
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <vector>
+#include "chunker.hpp"
+
+using namespace vista::circular::example;
+
+namespace
+{
+
+constexpr std::size_t window = 16;
+
+std::vector<std::uint8_t> make_stream(std::size_t size, std::uint32_t seed)
+{
+    // Linear congruential generator for reproducible content
+    std::vector<std::uint8_t> result;
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        result.push_back(std::uint8_t(seed >> 16));
+    }
+    return result;
+}
+
+std::vector<std::size_t> split(const std::vector<std::uint8_t>& stream,
+                               std::size_t block_size)
+{
+    chunker<window> cutter(64, 1024, 7);
+    std::vector<std::size_t> result;
+    for (std::size_t offset = 0; offset < stream.size(); offset += block_size)
+    {
+        const auto size = std::min(block_size, stream.size() - offset);
+        cutter.push_back(vista::span<const std::uint8_t>(stream.data() + offset, size),
+                         [&result] (std::size_t length) { result.push_back(length); });
+    }
+    result.push_back(cutter.size());
+    return result;
+}
+
+void test_rolling_hash()
+{
+    const auto stream = make_stream(200, 1);
+
+    rolling_hash<window> rolling;
+    for (std::size_t k = 0; k < stream.size(); ++k)
+    {
+        rolling.push_back(stream[k]);
+
+        // Compare with hash computed from scratch over the same window
+        const auto first = (k + 1 > window) ? k + 1 - window : 0;
+        rolling_hash<window> fresh;
+        fresh.push_back(vista::span<const std::uint8_t>(&stream[first], k + 1 - first));
+        assert(rolling.value() == fresh.value());
+    }
+}
+
+void test_chunk_sizes()
+{
+    const auto stream = make_stream(50000, 2);
+    const auto chunks = split(stream, stream.size());
+
+    std::size_t total = 0;
+    for (std::size_t k = 0; k < chunks.size(); ++k)
+    {
+        if (k + 1 < chunks.size())
+        {
+            assert(chunks[k] >= 64);
+            assert(chunks[k] <= 1024);
+        }
+        total += chunks[k];
+    }
+    assert(total == stream.size());
+    assert(chunks.size() > 100);
+
+    // Boundaries do not depend on how the stream is divided into blocks
+    assert(split(stream, 1) == chunks);
+    assert(split(stream, 100) == chunks);
+    assert(split(stream, 4096) == chunks);
+}
+
+void test_resynchronize()
+{
+    const auto stream = make_stream(50000, 3);
+    auto modified = stream;
+    modified.insert(modified.begin() + 1000, { 1, 2, 3 });
+
+    const auto original_chunks = split(stream, stream.size());
+    const auto modified_chunks = split(modified, modified.size());
+
+    // Chunks after the modification are the same
+    assert(std::equal(original_chunks.rbegin(),
+                      original_chunks.rbegin() + original_chunks.size() / 2,
+                      modified_chunks.rbegin()));
+}
+
+} // anonymous namespace
+
+int main()
+{
+    test_rolling_hash();
+    test_chunk_sizes();
+    test_resynchronize();
+    return 0;
+}
@@ -0,0 +1,264 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_DELAY_LINE_HPP
+#define VISTA_CIRCULAR_EXAMPLE_DELAY_LINE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <vista/circular_view.hpp>
+#include <vista/span.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Interpolation kernels.
+//
+// A kernel of a given width interpolates between the two middle samples of a
+// neighbourhood. The fraction is the distance from the first of the two
+// middle samples, and lies within the half-open range (0, 1].
+
+struct linear
+{
+    static constexpr std::size_t width = 2;
+
+    template <typename T>
+    static void weights(T fraction, T *output) noexcept
+    {
+        output[0] = T(1) - fraction;
+        output[1] = fraction;
+    }
+};
+
+// Catmull-Rom cubic Hermite spline
+
+struct cubic
+{
+    static constexpr std::size_t width = 4;
+
+    template <typename T>
+    static void weights(T fraction, T *output) noexcept
+    {
+        const T t = fraction;
+        const T t2 = t * t;
+        const T t3 = t2 * t;
+        output[0] = (-t3 + T(2) * t2 - t) / T(2);
+        output[1] = (T(3) * t3 - T(5) * t2 + T(2)) / T(2);
+        output[2] = (T(-3) * t3 + T(4) * t2 + t) / T(2);
+        output[3] = (t3 - t2) / T(2);
+    }
+};
+
+// Lagrange polynomial of odd order
+
+template <std::size_t Order>
+struct lagrange
+{
+    static_assert(Order % 2 == 1, "Order must be odd");
+
+    static constexpr std::size_t width = Order + 1;
+
+    template <typename T>
+    static void weights(T fraction, T *output) noexcept
+    {
+        // Nodes are placed at k - center, so the middle samples are at 0 and 1
+        constexpr int center = int(width / 2) - 1;
+        for (int k = 0; k < int(width); ++k)
+        {
+            T weight = T(1);
+            for (int j = 0; j < int(width); ++j)
+            {
+                if (j == k)
+                    continue;
+                weight *= (fraction - T(j - center)) / T(k - j);
+            }
+            output[k] = weight;
+        }
+    }
+};
+
+constexpr std::size_t linear::width;
+constexpr std::size_t cubic::width;
+template <std::size_t Order>
+constexpr std::size_t lagrange<Order>::width;
+
+// Delay line with fractional delays.
+//
+// Input samples are stored in a circular view over a storage array that is
+// extended with a guard region mirroring the first samples of the storage.
+// The neighbourhood of any sample is therefore contiguous in memory, and the
+// interpolation kernel can read its neighbours without wrapping.
+//
+// Outputs are produced in blocks. The fraction, and thereby the kernel
+// weights, is the same for all outputs in a block for a given delay, so the
+// weights are calculated once per block and tap. The wraparound is handled
+// once per block by splitting the block into at most two contiguous chunks.
+// Each chunk is processed with element-wise loops over contiguous memory that
+// compilers can vectorize.
+
+template <typename T, std::size_t N, typename Interpolator = cubic>
+class delay_line
+{
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+    static_assert(N >= Interpolator::width, "N must be at least the kernel width");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type width = Interpolator::width;
+
+    struct tap
+    {
+        value_type delay;
+        value_type gain;
+    };
+
+    delay_line() noexcept
+        : window(storage.begin(), storage.begin() + N)
+    {
+    }
+
+    // The window refers to the storage of this object
+    delay_line(const delay_line&) = delete;
+    delay_line& operator=(const delay_line&) = delete;
+
+    size_type size() const noexcept
+    {
+        return window.size();
+    }
+
+    size_type capacity() const noexcept
+    {
+        return window.capacity();
+    }
+
+    //! @brief Appends input sample.
+
+    void push_back(value_type input) noexcept
+    {
+        window.push_back(input);
+        const auto slot = size_type(&window.back() - storage.data());
+        if (slot < guard)
+        {
+            storage[N + slot] = input;
+        }
+    }
+
+    //! @brief Appends block of input samples.
+
+    void push_back(span<const value_type> input) noexcept
+    {
+        window.push_back(input.begin(), input.end());
+        std::copy(storage.begin(), storage.begin() + guard, storage.begin() + N);
+    }
+
+    //! @brief Returns the input delayed by a fractional number of samples.
+    //!
+    //! @pre width / 2 - 1 <= delay
+    //! @pre delay + 1 + width / 2 <= size()
+
+    value_type read(value_type delay) const noexcept
+    {
+        value_type result = 0;
+        const tap single[] = { { delay, value_type(1) } };
+        read(span<const tap>(single), span<value_type>(&result, 1));
+        return result;
+    }
+
+    //! @brief Writes a block of outputs with the sum of delayed taps.
+    //!
+    //! Output sample k corresponds to the input sample at position
+    //! size() - output.size() + k.
+    //!
+    //! @pre width / 2 - 1 <= tap.delay for all taps
+    //! @pre tap.delay + output.size() + width / 2 <= size() for all taps
+
+    void read(span<const tap> taps, span<value_type> output) const noexcept
+    {
+        std::fill(output.begin(), output.end(), value_type(0));
+        for (const auto& current : taps)
+        {
+            accumulate(current, output);
+        }
+    }
+
+private:
+    void accumulate(const tap& current, span<value_type> output) const noexcept
+    {
+        const size_type count = output.size();
+        assert(current.delay >= value_type(width / 2 - 1));
+        assert(current.delay + value_type(count + width / 2) <= value_type(size()));
+
+        // Position of the first output relative to the oldest input sample
+        const value_type position = value_type(size() - count) - current.delay;
+        size_type upper = size_type(position);
+        if (value_type(upper) < position)
+        {
+            ++upper;
+        }
+        const size_type whole = upper - 1;
+        const value_type fraction = position - value_type(whole);
+
+        value_type weights[width];
+        Interpolator::weights(fraction, weights);
+        for (auto& weight : weights)
+        {
+            weight *= current.gain;
+        }
+
+        // Only one modulo per block to locate the first neighbourhood
+        const value_type *first = &window[whole + 1 - width / 2];
+        const auto slot = size_type(first - storage.data());
+        const auto head = std::min(count, N - slot);
+        convolve(first, weights, output.data(), head);
+        convolve(storage.data(), weights, output.data() + head, count - head);
+    }
+
+    static void convolve(const value_type *input,
+                         const value_type *weights,
+                         value_type *output,
+                         size_type count) noexcept
+    {
+        for (size_type k = 0; k < width; ++k)
+        {
+            const value_type weight = weights[k];
+            const value_type *neighbour = input + k;
+            for (size_type t = 0; t < count; ++t)
+            {
+                output[t] += weight * neighbour[t];
+            }
+        }
+    }
+
+private:
+    static constexpr size_type guard = width - 1;
+
+    std::array<value_type, N + guard> storage = {};
+    circular_view<value_type, N> window;
+};
+
+template <typename T, std::size_t N, typename Interpolator>
+constexpr std::size_t delay_line<T, N, Interpolator>::width;
+
+template <typename T, std::size_t N, typename Interpolator>
+constexpr std::size_t delay_line<T, N, Interpolator>::guard;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_DELAY_LINE_HPP
@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include "delay_line.hpp"
+
+using namespace vista::circular::example;
+
+namespace
+{
+
+constexpr double tolerance = 1e-9;
+
+// Polynomials up to the order of the kernel are interpolated exactly
+
+double ramp(double time)
+{
+    return 0.5 * time - 3.0;
+}
+
+double curve(double time)
+{
+    return 0.01 * time * time * time - 0.2 * time * time + time;
+}
+
+template <typename Interpolator, typename Function>
+void test_single(Function function)
+{
+    delay_line<double, 16, Interpolator> line;
+    // Wrap around the storage several times
+    for (int time = 0; time < 40; ++time)
+    {
+        line.push_back(function(time));
+    }
+    assert(line.size() == 16);
+    // Newest sample was inserted at time 39
+    for (double delay = double(Interpolator::width / 2 - 1); delay <= 10.0; delay += 0.125)
+    {
+        assert(std::abs(line.read(delay) - function(39.0 - delay)) < tolerance);
+    }
+}
+
+template <typename Interpolator, typename Function>
+void test_block(Function function)
+{
+    delay_line<double, 32, Interpolator> line;
+    using tap = typename delay_line<double, 32, Interpolator>::tap;
+
+    constexpr int block = 8;
+    double input[block];
+    double output[block];
+    int time = 0;
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int k = 0; k < block; ++k, ++time)
+        {
+            input[k] = function(time);
+        }
+        line.push_back(vista::span<const double>(input, block));
+        if (line.size() < 20)
+            continue;
+
+        const tap taps[] = { { 2.25, 0.5 }, { 3.75, 0.25 }, { 9.5, -1.0 } };
+        line.read(vista::span<const tap>(taps), vista::span<double>(output, block));
+        for (int k = 0; k < block; ++k)
+        {
+            // Output k corresponds to input at time - block + k
+            const double now = double(time - block + k);
+            double expect = 0.0;
+            for (const auto& current : taps)
+            {
+                expect += current.gain * function(now - current.delay);
+            }
+            assert(std::abs(output[k] - expect) < tolerance);
+        }
+    }
+}
+
+} // anonymous namespace
+
+int main()
+{
+    test_single<linear>(ramp);
+    test_single<cubic>(ramp);
+    test_single<lagrange<3>>(curve);
+    test_single<lagrange<5>>(curve);
+
+    test_block<linear>(ramp);
+    test_block<cubic>(ramp);
+    test_block<lagrange<3>>(curve);
+    test_block<lagrange<5>>(curve);
+
+    // Integer delays return the stored samples
+    delay_line<double, 8, linear> line;
+    for (int time = 0; time < 8; ++time)
+    {
+        line.push_back(double(time * time));
+    }
+    assert(line.read(0.0) == 49.0);
+    assert(line.read(3.0) == 16.0);
+    assert(line.read(6.0) == 1.0);
+
+    return 0;
+}
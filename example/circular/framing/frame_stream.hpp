@@ -0,0 +1,177 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_FRAME_STREAM_HPP
+#define VISTA_CIRCULAR_EXAMPLE_FRAME_STREAM_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include <vista/circular_view.hpp>
+#include <vista/span.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Returns the coefficients of a periodic Hann window.
+
+template <typename T, std::size_t F>
+std::array<T, F> hann_window() noexcept
+{
+    const T pi = T(3.14159265358979323846);
+    std::array<T, F> result;
+    for (std::size_t k = 0; k < F; ++k)
+    {
+        result[k] = T(0.5) - T(0.5) * std::cos(T(2) * pi * T(k) / T(F));
+    }
+    return result;
+}
+
+// Overlapping frames of size F with hop size H from a stream of samples, as
+// used by short-time Fourier transforms and overlap-save convolution.
+//
+// The most recent F samples are kept in a circular view over a storage array
+// that is extended with a guard region of F - 1 elements. Samples written
+// to the start of the storage are mirrored into the guard region, so the
+// frame starting at any position is always contiguous in memory. Each input
+// sample is therefore copied at most once more, and frames are never copied.
+// The F - H samples that overlap with the previous frame remain in place.
+//
+// The window function is applied in a single pass over the contiguous frame.
+
+template <typename T, std::size_t F, std::size_t H>
+class frame_stream
+{
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+    static_assert(F > 0, "F must be greater than zero");
+    static_assert(H > 0 && H <= F, "H must be within [1, F]");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using frame_type = span<const value_type, F>;
+
+    static constexpr size_type frame_size = F;
+    static constexpr size_type hop_size = H;
+
+    explicit frame_stream(frame_type coefficients) noexcept
+        : window(storage.begin(), storage.begin() + F)
+    {
+        std::copy(coefficients.begin(), coefficients.end(), weights.begin());
+    }
+
+    // The window refers to the storage of this object
+    frame_stream(const frame_stream&) = delete;
+    frame_stream& operator=(const frame_stream&) = delete;
+
+    //! @brief Appends input samples.
+    //!
+    //! The function is invoked as @c function(frame) with the windowed frame
+    //! each time a frame is completed.
+    //!
+    //! Returns the number of completed frames.
+
+    template <typename Function>
+    size_type push_back(span<const value_type> input, Function&& function) noexcept(noexcept(function(std::declval<frame_type>())))
+    {
+        size_type frames = 0;
+        const value_type *data = input.data();
+        size_type remaining = input.size();
+        while (remaining > 0)
+        {
+            // Insert samples up to the next frame boundary
+            const size_type count = std::min(remaining, pending);
+            append(data, count);
+            data += count;
+            remaining -= count;
+            pending -= count;
+            if (pending == 0)
+            {
+                apply_window();
+                function(frame_type(output.data(), F));
+                pending = H;
+                ++frames;
+            }
+        }
+        return frames;
+    }
+
+    //! @brief Returns the most recent samples without windowing.
+    //!
+    //! @pre At least F samples have been appended.
+
+    frame_type frame() const noexcept
+    {
+        assert(window.full());
+        return frame_type(&window.front(), F);
+    }
+
+private:
+    void append(const value_type *data, size_type count) noexcept
+    {
+        assert(count <= F);
+
+        window.expand_back(count);
+        const auto slot = size_type(&window[window.size() - count] - storage.data());
+        const auto head = std::min(count, F - slot);
+        store(slot, data, head);
+        store(0, data + head, count - head);
+    }
+
+    void store(size_type slot, const value_type *data, size_type count) noexcept
+    {
+        std::copy(data, data + count, storage.begin() + slot);
+        // Mirror the part that overlaps the start of the storage
+        if (slot < guard)
+        {
+            const auto mirrored = std::min(count, guard - slot);
+            std::copy(data, data + mirrored, storage.begin() + F + slot);
+        }
+    }
+
+    void apply_window() noexcept
+    {
+        const value_type *input = &window.front();
+        for (size_type k = 0; k < F; ++k)
+        {
+            output[k] = input[k] * weights[k];
+        }
+    }
+
+private:
+    static constexpr size_type guard = F - 1;
+
+    std::array<value_type, F + guard> storage = {};
+    circular_view<value_type, F> window;
+    std::array<value_type, F> weights;
+    std::array<value_type, F> output;
+    size_type pending = F;
+};
+
+template <typename T, std::size_t F, std::size_t H>
+constexpr std::size_t frame_stream<T, F, H>::frame_size;
+
+template <typename T, std::size_t F, std::size_t H>
+constexpr std::size_t frame_stream<T, F, H>::hop_size;
+
+template <typename T, std::size_t F, std::size_t H>
+constexpr std::size_t frame_stream<T, F, H>::guard;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_FRAME_STREAM_HPP
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <vector>
+#include "frame_stream.hpp"
+
+using namespace vista::circular::example;
+
+namespace
+{
+
+constexpr std::size_t frame_size = 8;
+constexpr std::size_t hop_size = 3;
+
+using stream_type = frame_stream<double, frame_size, hop_size>;
+
+// Feeds the signal in chunks and collects the windowed frames.
+
+std::vector<std::vector<double>> analyze(const std::vector<double>& signal,
+                                         const std::array<double, frame_size>& weights,
+                                         std::size_t chunk)
+{
+    std::vector<std::vector<double>> result;
+    stream_type stream(stream_type::frame_type(weights.data(), frame_size));
+    std::size_t frames = 0;
+    for (std::size_t offset = 0; offset < signal.size(); offset += chunk)
+    {
+        const auto count = std::min(chunk, signal.size() - offset);
+        frames += stream.push_back(vista::span<const double>(signal.data() + offset, count),
+                                   [&result] (stream_type::frame_type frame)
+                                   {
+                                       result.emplace_back(frame.begin(), frame.end());
+                                   });
+    }
+    assert(frames == result.size());
+    return result;
+}
+
+} // anonymous namespace
+
+int main()
+{
+    std::vector<double> signal;
+    for (int k = 0; k < 50; ++k)
+    {
+        signal.push_back(double(k));
+    }
+
+    // Rectangular window returns the raw frames
+    {
+        std::array<double, frame_size> rectangular;
+        rectangular.fill(1.0);
+        const auto frames = analyze(signal, rectangular, 1);
+        // First frame after frame_size samples, then one per hop
+        assert(frames.size() == 1 + (signal.size() - frame_size) / hop_size);
+        for (std::size_t which = 0; which < frames.size(); ++which)
+        {
+            for (std::size_t k = 0; k < frame_size; ++k)
+            {
+                assert(frames[which][k] == double(which * hop_size + k));
+            }
+        }
+    }
+
+    // Frames are independent of the chunk size of the input
+    {
+        const auto weights = hann_window<double, frame_size>();
+        const auto expect = analyze(signal, weights, 1);
+        for (std::size_t chunk : { 2, 5, 7, 8, 13, 50 })
+        {
+            const auto frames = analyze(signal, weights, chunk);
+            assert(frames == expect);
+        }
+        for (std::size_t which = 0; which < expect.size(); ++which)
+        {
+            for (std::size_t k = 0; k < frame_size; ++k)
+            {
+                assert(std::abs(expect[which][k] - weights[k] * double(which * hop_size + k)) < 1e-12);
+            }
+        }
+    }
+
+    // Raw frame is a contiguous view into the storage
+    {
+        std::array<double, frame_size> rectangular;
+        rectangular.fill(1.0);
+        stream_type stream(stream_type::frame_type(rectangular.data(), frame_size));
+        stream.push_back(vista::span<const double>(signal.data(), 21), [] (stream_type::frame_type) {});
+        for (std::size_t k = 0; k < frame_size; ++k)
+        {
+            assert(stream.frame()[k] == double(21 - frame_size + k));
+        }
+    }
+
+    return 0;
+}
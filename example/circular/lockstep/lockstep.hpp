@@ -0,0 +1,124 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_LOCKSTEP_HPP
+#define VISTA_CIRCULAR_EXAMPLE_LOCKSTEP_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <vista/circular_array.hpp>
+#include <vista/span.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// K running averages over windows of N values that are all updated together.
+//
+// The K windows share a single circular array whose elements are rows of K
+// values. The storage is therefore transposed, [slot][window], and all
+// windows share the same head index. Inserting one value into every window
+// is a single contiguous row store, and the running sums are updated with
+// element-wise loops over contiguous rows that compilers can vectorize.
+
+template <typename T, std::size_t K, std::size_t N>
+class lockstep_average
+    : protected circular_array<std::array<T, K>, N>
+{
+    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
+    static_assert(K > 0, "K must be greater than zero");
+    static_assert(N > 0, "N must be greater than zero");
+
+    using row_type = std::array<T, K>;
+    using window = circular_array<row_type, N>;
+
+public:
+    using value_type = T;
+    using size_type = typename window::size_type;
+
+    lockstep_average() noexcept = default;
+
+    //! @brief Appends one data point to each of the K windows.
+
+    void push_all(span<const value_type, K> input) noexcept
+    {
+        const value_type *data = input.data();
+
+        // Update the running sums
+        if (window::full())
+        {
+            // Undo the effect of the entries leaving the windows
+            const row_type& oldest = window::front();
+            for (size_type k = 0; k < K; ++k)
+            {
+                sum[k] += data[k] - oldest[k];
+            }
+        }
+        else
+        {
+            for (size_type k = 0; k < K; ++k)
+            {
+                sum[k] += data[k];
+            }
+        }
+        // Remember the input values for later use
+        window::expand_back();
+        row_type& newest = window::back();
+        for (size_type k = 0; k < K; ++k)
+        {
+            newest[k] = data[k];
+        }
+    }
+
+    using window::empty;
+    using window::size;
+
+    //! @brief Returns biased mean of the given window.
+    //!
+    //! @pre size() > 0
+    //! @pre which < K
+
+    value_type mean(size_type which) const noexcept
+    {
+        assert(!empty());
+        assert(which < K);
+
+        return sum[which] / size();
+    }
+
+    //! @brief Writes the biased means of all windows to output.
+    //!
+    //! @pre size() > 0
+
+    void means(span<value_type, K> output) const noexcept
+    {
+        assert(!empty());
+
+        value_type *data = output.data();
+        const value_type count = value_type(size());
+        for (size_type k = 0; k < K; ++k)
+        {
+            data[k] = sum[k] / count;
+        }
+    }
+
+private:
+    row_type sum = {};
+};
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_LOCKSTEP_HPP
@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include "lockstep.hpp"
+
+using namespace vista::circular::example;
+
+int main()
+{
+    lockstep_average<double, 3, 2> filter;
+
+    double tick1[3] = { 11.0, 110.0, 1100.0 };
+    filter.push_all(vista::span<const double, 3>(tick1));
+    assert(filter.mean(0) == 11.0);
+    assert(filter.mean(1) == 110.0);
+    assert(filter.mean(2) == 1100.0);
+
+    double tick2[3] = { 22.0, 220.0, 2200.0 };
+    filter.push_all(vista::span<const double, 3>(tick2));
+    assert(filter.mean(0) == (11.0 + 22.0) / 2.0);
+    assert(filter.mean(1) == (110.0 + 220.0) / 2.0);
+    assert(filter.mean(2) == (1100.0 + 2200.0) / 2.0);
+
+    double tick3[3] = { 33.0, 330.0, 3300.0 };
+    filter.push_all(vista::span<const double, 3>(tick3));
+    assert(filter.mean(0) == (22.0 + 33.0) / 2.0);
+    assert(filter.mean(1) == (220.0 + 330.0) / 2.0);
+    assert(filter.mean(2) == (2200.0 + 3300.0) / 2.0);
+
+    double result[3] = {};
+    filter.means(vista::span<double, 3>(result));
+    assert(result[0] == (22.0 + 33.0) / 2.0);
+    assert(result[1] == (220.0 + 330.0) / 2.0);
+    assert(result[2] == (2200.0 + 3300.0) / 2.0);
+
+    return 0;
+}
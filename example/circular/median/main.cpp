@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include "sliding_percentile.hpp"
+
+using namespace vista::circular::example;
+
+// Compares against sorting the window for every sample
+template <typename Percentile>
+void compare_with_sort(Percentile& statistic, std::size_t percent)
+{
+    // Linear congruential generator for reproducible latencies
+    std::uint32_t seed = 1;
+    for (int k = 0; k < 2000; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        // Narrow range to get duplicates
+        statistic.push(int((seed >> 16) % 100));
+
+        std::vector<int> sorted(statistic.window().begin(), statistic.window().end());
+        std::sort(sorted.begin(), sorted.end());
+        std::size_t rank = (sorted.size() * percent + 99) / 100;
+        rank = (rank == 0) ? 1 : rank;
+        assert(statistic.percentile() == sorted[rank - 1]);
+        if (rank < sorted.size())
+        {
+            assert(statistic.successor() == sorted[rank]);
+        }
+    }
+}
+
+int main()
+{
+    // Rolling median of the last five latencies
+    {
+        sliding_median<int, 5> latency;
+        latency.push(30);
+        assert(latency.percentile() == 30);
+        latency.push(10);
+        assert(latency.percentile() == 10);
+        assert(latency.successor() == 30);
+        latency.push(20);
+        assert(latency.percentile() == 20);
+        latency.push(50);
+        latency.push(40);
+        assert(latency.full());
+        assert(latency.percentile() == 30);
+        // Evicts 30
+        latency.push(60);
+        assert(latency.window().front() == 10);
+        assert(latency.percentile() == 40);
+        // Evicts 10
+        latency.push(0);
+        assert(latency.percentile() == 40);
+        // Evicts 20
+        latency.push(5);
+        assert(latency.percentile() == 40);
+        // Evicts 50
+        latency.push(1);
+        assert(latency.percentile() == 5);
+    }
+    {
+        sliding_median<int, 1> latency;
+        latency.push(3);
+        latency.push(7);
+        assert(latency.size() == 1);
+        assert(latency.percentile() == 7);
+    }
+    {
+        sliding_median<int, 31> median;
+        compare_with_sort(median, 50);
+        sliding_median<int, 32> even_median;
+        compare_with_sort(even_median, 50);
+        sliding_percentile<int, 50, 99> tail;
+        compare_with_sort(tail, 99);
+        sliding_percentile<int, 20, 1> head;
+        compare_with_sort(head, 1);
+        sliding_percentile<int, 20, 100> maximum;
+        compare_with_sort(maximum, 100);
+    }
+    return 0;
+}
@@ -0,0 +1,226 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_SLIDING_PERCENTILE_HPP
+#define VISTA_CIRCULAR_EXAMPLE_SLIDING_PERCENTILE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstddef>
+#include <vista/circular_array.hpp>
+#include <vista/functional.hpp>
+#include <vista/indexed_priority_view.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Percentile over a moving window of the most recent samples.
+//
+// The samples in the window are split into two indexed priority views. The
+// lower part keeps the smallest samples with the largest on top, and the upper
+// part keeps the remaining samples with the smallest on top. The lower part
+// holds the nearest-rank number of samples for the percentile, so the
+// percentile is the topmost element of the lower part.
+//
+// The window itself is a circular array. Samples are given handles in the
+// priority views that cycle through the capacity of the window, so the sample
+// evicted from a full window has the same handle as the new sample. The
+// evicted sample is therefore removed from either priority view directly
+// rather than searched for. If the new sample belongs to the same part as the
+// evicted sample, then the evicted sample is simply updated in place.
+//
+// Insertion takes logarithmic time in the window size, and the percentile is
+// found in constant time. All storage is fixed.
+
+template <typename T,
+          std::size_t N,
+          std::size_t Percent = 50,
+          typename Compare = vista::less<T>>
+class sliding_percentile
+{
+    static_assert(N > 0, "N must be greater than zero");
+    static_assert(Percent > 0 && Percent <= 100, "Percent must be in range (0, 100]");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using window_type = circular_array<value_type, N>;
+
+    sliding_percentile() noexcept
+        : lower(lower_values, lower_indices),
+          upper(upper_values, upper_indices)
+    {
+    }
+
+    sliding_percentile(const sliding_percentile&) = delete;
+    sliding_percentile& operator=(const sliding_percentile&) = delete;
+
+    //! @brief Checks if the window is empty.
+
+    bool empty() const noexcept
+    {
+        return samples.empty();
+    }
+
+    //! @brief Checks if the window is full.
+
+    bool full() const noexcept
+    {
+        return samples.full();
+    }
+
+    //! @brief Returns the number of samples in the window.
+
+    size_type size() const noexcept
+    {
+        return samples.size();
+    }
+
+    //! @brief Returns the samples in the window from oldest to newest.
+
+    const window_type& window() const noexcept
+    {
+        return samples;
+    }
+
+    //! @brief Returns the nearest-rank percentile of the samples in the window.
+    //!
+    //! The median is the lower median if the window has an even number of
+    //! samples.
+    //!
+    //! @pre !empty()
+
+    const value_type& percentile() const noexcept
+    {
+        return lower.top();
+    }
+
+    //! @brief Returns the sample ranked just after the percentile.
+    //!
+    //! The median of an even number of samples is the mean of percentile()
+    //! and successor().
+    //!
+    //! @pre The window has samples ranked after the percentile.
+
+    const value_type& successor() const noexcept
+    {
+        return upper.top();
+    }
+
+    //! @brief Inserts sample into the window.
+    //!
+    //! The oldest sample is evicted if the window is full.
+
+    void push(value_type input) noexcept
+    {
+        const size_type handle = next;
+        next = (next + 1 == N) ? 0 : next + 1;
+
+        if (samples.full())
+        {
+            // Evicted sample has the same handle as the new sample
+            if (lower.contains(handle))
+            {
+                if (upper.empty() || !before(upper.top(), input))
+                {
+                    lower.update(handle, input);
+                    samples.push_back(std::move(input));
+                    return;
+                }
+                lower.erase(handle);
+            }
+            else
+            {
+                if (!before(input, lower.top()))
+                {
+                    upper.update(handle, input);
+                    samples.push_back(std::move(input));
+                    return;
+                }
+                upper.erase(handle);
+            }
+        }
+        samples.push_back(input);
+        insert(handle, std::move(input));
+        rebalance();
+    }
+
+private:
+    struct reverse_compare
+    {
+        bool operator()(const value_type& lhs, const value_type& rhs) const noexcept
+        {
+            return Compare{}(rhs, lhs);
+        }
+    };
+
+    static bool before(const value_type& lhs, const value_type& rhs) noexcept
+    {
+        return Compare{}(lhs, rhs);
+    }
+
+    // Nearest rank of the percentile
+    size_type rank() const noexcept
+    {
+        const size_type result = (size() * Percent + 99) / 100;
+        return (result == 0 && !empty()) ? 1 : result;
+    }
+
+    void insert(size_type handle, value_type input) noexcept
+    {
+        const bool is_lower = lower.empty()
+            ? (upper.empty() || !before(upper.top(), input))
+            : !before(lower.top(), input);
+        if (is_lower)
+            lower.push(handle, std::move(input));
+        else
+            upper.push(handle, std::move(input));
+    }
+
+    void rebalance() noexcept
+    {
+        const size_type wanted = rank();
+        while (lower.size() > wanted)
+        {
+            const auto handle = lower.top_handle();
+            upper.push(handle, lower.top());
+            lower.pop();
+        }
+        while (lower.size() < wanted)
+        {
+            const auto handle = upper.top_handle();
+            lower.push(handle, upper.top());
+            upper.pop();
+        }
+        assert(lower.size() == wanted);
+    }
+
+private:
+    window_type samples;
+    size_type next = 0;
+    value_type lower_values[N];
+    size_type lower_indices[2 * N];
+    value_type upper_values[N];
+    size_type upper_indices[2 * N];
+    indexed_priority_view<value_type, N, Compare> lower;
+    indexed_priority_view<value_type, N, reverse_compare> upper;
+};
+
+template <typename T, std::size_t N>
+using sliding_median = sliding_percentile<T, N, 50>;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_SLIDING_PERCENTILE_HPP
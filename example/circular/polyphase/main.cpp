@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <vector>
+#include "polyphase.hpp"
+
+using namespace vista::circular::example;
+
+namespace
+{
+
+// Direct-form filter where missing history is zero
+
+std::vector<double> convolve(const std::vector<double>& input,
+                             const std::vector<double>& coefficients)
+{
+    std::vector<double> result(input.size());
+    for (std::size_t n = 0; n < input.size(); ++n)
+    {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < coefficients.size() && k <= n; ++k)
+        {
+            sum += coefficients[k] * input[n - k];
+        }
+        result[n] = sum;
+    }
+    return result;
+}
+
+std::vector<double> make_signal(std::size_t size)
+{
+    std::vector<double> result;
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        result.push_back(double((k * 7) % 11) - 5.0);
+    }
+    return result;
+}
+
+void test_decimator()
+{
+    constexpr std::size_t taps = 7;
+    constexpr std::size_t factor = 3;
+    const std::vector<double> coefficients = { 1.0, 2.0, 3.0, 4.0, 3.0, 2.0, 1.0 };
+    const auto signal = make_signal(50);
+
+    // Filter everything and keep every factor-th output
+    const auto filtered = convolve(signal, coefficients);
+    std::vector<double> expect;
+    for (std::size_t n = 0; n < filtered.size(); n += factor)
+    {
+        expect.push_back(filtered[n]);
+    }
+
+    decimator<double, taps, factor> filter(vista::span<const double, taps>(coefficients.data(), taps));
+    std::vector<double> output(signal.size());
+    std::size_t count = 0;
+    // Process in blocks that are not multiples of the factor
+    for (std::size_t offset = 0; offset < signal.size(); offset += 8)
+    {
+        const auto size = std::min<std::size_t>(8, signal.size() - offset);
+        count += filter.process(vista::span<const double>(signal.data() + offset, size),
+                                vista::span<double>(output.data() + count, output.size() - count));
+    }
+    output.resize(count);
+    assert(output == expect);
+}
+
+void test_interpolator()
+{
+    constexpr std::size_t taps = 8;
+    constexpr std::size_t factor = 3;
+    const std::vector<double> coefficients = { 1.0, 2.0, 3.0, 4.0, 4.0, 3.0, 2.0, 1.0 };
+    const auto signal = make_signal(20);
+
+    // Insert zeros between samples and filter everything
+    std::vector<double> upsampled;
+    for (auto sample : signal)
+    {
+        upsampled.push_back(sample);
+        for (std::size_t k = 1; k < factor; ++k)
+        {
+            upsampled.push_back(0.0);
+        }
+    }
+    const auto expect = convolve(upsampled, coefficients);
+
+    interpolator<double, taps, factor> filter(vista::span<const double, taps>(coefficients.data(), taps));
+    std::vector<double> output(signal.size() * factor);
+    const auto count = filter.process(vista::span<const double>(signal.data(), signal.size()),
+                                      vista::span<double>(output.data(), output.size()));
+    // Every input sample produces factor output samples
+    output.resize(count);
+    assert(output == expect);
+}
+
+} // anonymous namespace
+
+int main()
+{
+    test_decimator();
+    test_interpolator();
+    return 0;
+}
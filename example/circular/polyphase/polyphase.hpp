@@ -0,0 +1,199 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_POLYPHASE_HPP
+#define VISTA_CIRCULAR_EXAMPLE_POLYPHASE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <vista/circular_array.hpp>
+#include <vista/span.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Dot product between the elements of a circular array, from oldest to
+// newest, and the coefficients. Each segment of the circular array is
+// contiguous, so the dot product is calculated with one element-wise loop per
+// segment that compilers can vectorize.
+
+template <typename T, std::size_t N>
+T segment_dot(const circular_array<T, N>& history,
+              const T *coefficients) noexcept
+{
+    assert(history.full());
+
+    T result = {};
+    const auto first = history.first_segment();
+    for (std::size_t k = 0; k < first.size(); ++k)
+    {
+        result += first[k] * coefficients[k];
+    }
+    coefficients += first.size();
+    const auto last = history.last_segment();
+    for (std::size_t k = 0; k < last.size(); ++k)
+    {
+        result += last[k] * coefficients[k];
+    }
+    return result;
+}
+
+// Decimating Finite Impulse Response filter.
+//
+// Filters the input and keeps every M-th output. Only the kept outputs are
+// calculated, which reduces the work by a factor of M compared to filtering
+// every input and then discarding outputs.
+
+template <typename T, std::size_t Taps, std::size_t M>
+class decimator
+{
+    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
+    static_assert(Taps > 0, "Taps must be greater than zero");
+    static_assert(M > 0, "M must be greater than zero");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //! @brief Creates decimator with filter coefficients.
+    //!
+    //! The history is initially filled with zeros.
+
+    explicit decimator(span<const value_type, Taps> coefficients) noexcept
+    {
+        // Reversed so that the oldest input is paired with the last coefficient
+        for (size_type k = 0; k < Taps; ++k)
+        {
+            reversed[k] = coefficients[Taps - 1 - k];
+        }
+        history.expand_back(Taps);
+        for (auto& entry : history)
+        {
+            entry = value_type{};
+        }
+    }
+
+    //! @brief Filters and decimates input.
+    //!
+    //! Returns the number of outputs written.
+    //!
+    //! @pre output.size() >= (input.size() + M - 1) / M
+
+    size_type process(span<const value_type> input,
+                      span<value_type> output) noexcept
+    {
+        size_type count = 0;
+        for (const auto& sample : input)
+        {
+            history.push_back(sample);
+            if (++phase == M)
+            {
+                phase = 0;
+                assert(count < output.size());
+                output[count++] = segment_dot(history, reversed.data());
+            }
+        }
+        return count;
+    }
+
+private:
+    circular_array<value_type, Taps> history;
+    std::array<value_type, Taps> reversed;
+    size_type phase = M - 1;
+};
+
+// Interpolating Finite Impulse Response filter.
+//
+// Upsamples the input by a factor of L and filters the result. Instead of
+// inserting L - 1 zeros between input samples, the filter is decomposed into
+// L polyphase branches, each with every L-th coefficient. Each output is
+// calculated by one branch over the input history, which avoids multiplying
+// with the inserted zeros.
+//
+// The coefficients are used as given, so they should include a gain of L to
+// preserve the signal amplitude.
+
+template <typename T, std::size_t Taps, std::size_t L>
+class interpolator
+{
+    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
+    static_assert(Taps > 0, "Taps must be greater than zero");
+    static_assert(L > 0, "L must be greater than zero");
+
+    static constexpr std::size_t branch_size = (Taps + L - 1) / L;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //! @brief Creates interpolator with filter coefficients.
+    //!
+    //! The history is initially filled with zeros.
+
+    explicit interpolator(span<const value_type, Taps> coefficients) noexcept
+    {
+        // Branch p contains coefficients p, p + L, p + 2L, and so on, in
+        // reverse order to match the history from oldest to newest.
+        for (size_type p = 0; p < L; ++p)
+        {
+            for (size_type k = 0; k < branch_size; ++k)
+            {
+                const auto index = k * L + p;
+                branches[p][branch_size - 1 - k] = (index < Taps) ? coefficients[index] : value_type{};
+            }
+        }
+        history.expand_back(branch_size);
+        for (auto& entry : history)
+        {
+            entry = value_type{};
+        }
+    }
+
+    //! @brief Upsamples and filters input.
+    //!
+    //! Returns the number of outputs written.
+    //!
+    //! @pre output.size() >= input.size() * L
+
+    size_type process(span<const value_type> input,
+                      span<value_type> output) noexcept
+    {
+        assert(output.size() >= input.size() * L);
+
+        size_type count = 0;
+        for (const auto& sample : input)
+        {
+            history.push_back(sample);
+            for (size_type p = 0; p < L; ++p)
+            {
+                output[count++] = segment_dot(history, branches[p].data());
+            }
+        }
+        return count;
+    }
+
+private:
+    circular_array<value_type, branch_size> history;
+    std::array<std::array<value_type, branch_size>, L> branches;
+};
+
+template <typename T, std::size_t Taps, std::size_t L>
+constexpr std::size_t interpolator<T, Taps, L>::branch_size;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_POLYPHASE_HPP
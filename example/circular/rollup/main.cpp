@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include "rollup.hpp"
+
+using namespace vista::circular::example;
+
+int main()
+{
+    // 10 buckets of 1 second, 6 buckets of 5 seconds, 4 buckets of 30 seconds
+    using archive_type = rollup<summary<double>, 10, 6, 4>;
+    archive_type archive(std::array<archive_type::time_type, 3>{{ 1, 5, 30 }});
+
+    for (int time = 0; time < 200; ++time)
+    {
+        archive.push(time, double(time));
+    }
+
+    assert(archive.level<0>().size() == 10);
+    assert(archive.level<0>().front().time == 190);
+    assert(archive.level<1>().front().time == 170);
+    assert(archive.level<1>().back().aggregate.count == 4);
+    assert(archive.level<2>().front().time == 90);
+
+    // Only the last seconds
+    assert(archive.aggregate(195, 200).count == 5);
+    assert(archive.aggregate(195, 200).min == 195.0);
+    assert(archive.aggregate(195, 200).max == 199.0);
+    // Seconds, 5 seconds, and 30 seconds
+    assert(archive.aggregate(0, 200).count == 110);
+    assert(archive.aggregate(0, 200).min == 90.0);
+    assert(archive.aggregate(0, 200).max == 199.0);
+    assert(archive.aggregate(0, 200).sum == (90.0 + 199.0) * 110 / 2);
+    // Coarse buckets are included if they start within the interval
+    assert(archive.aggregate(100, 200).count == 80);
+    assert(archive.aggregate(100, 200).min == 120.0);
+
+    return 0;
+}
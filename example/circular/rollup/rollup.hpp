@@ -0,0 +1,257 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_ROLLUP_HPP
+#define VISTA_CIRCULAR_EXAMPLE_ROLLUP_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vista/circular_array.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Aggregate with count, sum, minimum, and maximum of samples.
+
+template <typename T>
+struct summary
+{
+    using input_type = T;
+
+    void insert(input_type input) noexcept
+    {
+        ++count;
+        sum += input;
+        min = (input < min) ? input : min;
+        max = (input > max) ? input : max;
+    }
+
+    void merge(const summary& other) noexcept
+    {
+        count += other.count;
+        sum += other.sum;
+        min = (other.min < min) ? other.min : min;
+        max = (other.max > max) ? other.max : max;
+    }
+
+    std::size_t count = 0;
+    T sum = {};
+    T min = std::numeric_limits<T>::max();
+    T max = std::numeric_limits<T>::lowest();
+};
+
+// Multi-resolution round-robin archive.
+//
+// Samples are aggregated into buckets at several levels of increasing time
+// resolution, where each level is a circular array with its own capacity.
+// When a bucket is completed at one level, it is folded into the current
+// bucket at the next coarser level. Old buckets are overwritten when a level
+// is full. All levels therefore occupy fixed memory, and ingestion takes
+// amortized constant time.
+//
+// The Aggregate type must be default constructible, and must provide
+//
+//   using input_type = ...;
+//   void insert(input_type);
+//   void merge(const Aggregate&);
+
+template <typename Aggregate, std::size_t... Capacities>
+class rollup
+{
+public:
+    using time_type = std::int64_t;
+    using aggregate_type = Aggregate;
+    using input_type = typename aggregate_type::input_type;
+    using size_type = std::size_t;
+
+    static constexpr size_type levels = sizeof...(Capacities);
+
+    struct bucket
+    {
+        time_type time = 0;
+        aggregate_type aggregate;
+    };
+
+    //! @brief Creates rollup with the given bucket duration for each level.
+    //!
+    //! @pre Each resolution is a multiple of the previous resolution.
+    //! @pre Each capacity can hold the buckets of one bucket at the next level.
+
+    explicit rollup(const std::array<time_type, levels>& resolutions) noexcept
+        : resolutions(resolutions)
+    {
+        const size_type capacities[] = { Capacities... };
+        for (size_type level = 0; level < levels; ++level)
+        {
+            assert(resolutions[level] > 0);
+            if (level + 1 < levels)
+            {
+                assert(resolutions[level + 1] % resolutions[level] == 0);
+                assert(capacities[level] >= size_type(resolutions[level + 1] / resolutions[level]));
+            }
+        }
+        (void)capacities;
+    }
+
+    //! @brief Returns the bucket duration at level.
+
+    time_type resolution(size_type level) const noexcept
+    {
+        return resolutions[level];
+    }
+
+    //! @brief Returns the buckets at level.
+
+    template <std::size_t Level>
+    auto level() const noexcept -> const typename std::tuple_element<Level, std::tuple<circular_array<bucket, Capacities>...>>::type&
+    {
+        return std::get<Level>(rings);
+    }
+
+    //! @brief Inserts sample.
+    //!
+    //! @pre time is non-negative and not older than any previous sample.
+
+    void push(time_type time, input_type input) noexcept
+    {
+        update<0>(time, inserter{ std::move(input) });
+    }
+
+    //! @brief Returns aggregate of buckets that start within time interval.
+    //!
+    //! The finest resolution available is used for each part of the interval.
+
+    aggregate_type aggregate(time_type from, time_type to) const noexcept
+    {
+        aggregate_type result{};
+        gather<0>(from, to, result);
+        return result;
+    }
+
+private:
+    template <std::size_t Level>
+    using has_next = std::integral_constant<bool, (Level + 1 < levels)>;
+
+    struct inserter
+    {
+        void operator()(aggregate_type& aggregate) const noexcept
+        {
+            aggregate.insert(input);
+        }
+
+        input_type input;
+    };
+
+    struct merger
+    {
+        void operator()(aggregate_type& aggregate) const noexcept
+        {
+            aggregate.merge(other);
+        }
+
+        const aggregate_type& other;
+    };
+
+    template <std::size_t Level, typename Function>
+    void update(time_type time, const Function& function) noexcept
+    {
+        auto& ring = std::get<Level>(rings);
+        const time_type start = time - time % resolutions[Level];
+        if (ring.empty() || ring.back().time != start)
+        {
+            assert(ring.empty() || ring.back().time < start);
+
+            if (!ring.empty())
+            {
+                // Fold completed bucket into next level before it can be
+                // overwritten
+                cascade<Level>(ring.back(), has_next<Level>{});
+            }
+            ring.expand_back();
+            ring.back().time = start;
+            ring.back().aggregate = aggregate_type{};
+        }
+        function(ring.back().aggregate);
+    }
+
+    template <std::size_t Level>
+    void cascade(const bucket& completed, std::true_type) noexcept
+    {
+        update<Level + 1>(completed.time, merger{ completed.aggregate });
+    }
+
+    template <std::size_t Level>
+    void cascade(const bucket&, std::false_type) noexcept
+    {
+    }
+
+    template <std::size_t Level>
+    void gather(time_type from, time_type to, aggregate_type& result) const noexcept
+    {
+        const auto& ring = std::get<Level>(rings);
+        if (ring.empty())
+            return;
+
+        // Buckets older than the boundary are taken from the next level.
+        // Nothing has been overwritten unless the level is full. The boundary
+        // is aligned with the buckets of the next level to avoid counting
+        // samples twice.
+        time_type boundary = from;
+        if (has_next<Level>::value && ring.full())
+        {
+            const time_type coarse = resolutions[(Level + 1 < levels) ? Level + 1 : Level];
+            const time_type aligned = ((ring.front().time + coarse - 1) / coarse) * coarse;
+            boundary = (aligned > from) ? aligned : from;
+        }
+        for (const auto& current : ring)
+        {
+            if (current.time >= boundary && current.time < to)
+            {
+                result.merge(current.aggregate);
+            }
+        }
+        if (boundary > from)
+        {
+            gather_next<Level>(from, (boundary < to) ? boundary : to, result, has_next<Level>{});
+        }
+    }
+
+    template <std::size_t Level>
+    void gather_next(time_type from, time_type to, aggregate_type& result, std::true_type) const noexcept
+    {
+        gather<Level + 1>(from, to, result);
+    }
+
+    template <std::size_t Level>
+    void gather_next(time_type, time_type, aggregate_type&, std::false_type) const noexcept
+    {
+    }
+
+private:
+    std::array<time_type, levels> resolutions;
+    std::tuple<circular_array<bucket, Capacities>...> rings;
+};
+
+template <typename Aggregate, std::size_t... Capacities>
+constexpr std::size_t rollup<Aggregate, Capacities...>::levels;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_ROLLUP_HPP
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include "rolling_rows.hpp"
+
+using namespace vista::circular::example;
+
+namespace
+{
+
+constexpr std::size_t height = 4;
+constexpr std::size_t width = 3;
+
+using buffer_type = rolling_rows<float, height, width>;
+
+// Value of element at column in the n-th row ever inserted
+float make_value(std::size_t n, std::size_t column)
+{
+    return float(n * 10 + column);
+}
+
+// Sum of column over all rows in a block, using the column stride
+template <typename Block>
+float column_sum(const Block& block, std::size_t column)
+{
+    float result = 0.0f;
+    for (std::size_t r = 0; r < block.rows(); ++r)
+    {
+        result += block.data[r * Block::stride + column];
+    }
+    return result;
+}
+
+void test_rows()
+{
+    buffer_type buffer;
+    assert(buffer.empty());
+
+    for (std::size_t n = 0; n < 10; ++n)
+    {
+        auto row = buffer.push_back();
+        for (std::size_t c = 0; c < width; ++c)
+        {
+            row[c] = make_value(n, c);
+        }
+
+        const auto rows = std::min(n + 1, height);
+        assert(buffer.size() == rows);
+        for (std::size_t r = 0; r < rows; ++r)
+        {
+            for (std::size_t c = 0; c < width; ++c)
+            {
+                assert(buffer[r][c] == make_value(n + 1 - rows + r, c));
+            }
+        }
+    }
+    assert(buffer.full());
+}
+
+void test_last()
+{
+    buffer_type buffer;
+    for (std::size_t n = 0; n < 10; ++n)
+    {
+        const float input[width] = { make_value(n, 0), make_value(n, 1), make_value(n, 2) };
+        buffer.push_back(buffer_type::const_row_type(input));
+
+        const auto& view = buffer;
+        for (std::size_t count = 0; count <= view.size(); ++count)
+        {
+            const auto blocks = view.last(count);
+            assert(blocks.rows() == count);
+
+            // Rows are ordered from oldest to newest across the blocks
+            std::size_t expect = n + 1 - count;
+            for (std::size_t r = 0; r < blocks.first.rows(); ++r, ++expect)
+            {
+                assert(blocks.first(r, 1) == make_value(expect, 1));
+            }
+            for (std::size_t r = 0; r < blocks.second.rows(); ++r, ++expect)
+            {
+                assert(blocks.second.row(r)[2] == make_value(expect, 2));
+            }
+
+            float sum = 0.0f;
+            for (std::size_t k = n + 1 - count; k <= n; ++k)
+            {
+                sum += make_value(k, 0);
+            }
+            assert(column_sum(blocks.first, 0) + column_sum(blocks.second, 0) == sum);
+        }
+    }
+}
+
+} // anonymous namespace
+
+int main()
+{
+    test_rows();
+    test_last();
+    return 0;
+}
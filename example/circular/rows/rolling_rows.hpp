@@ -0,0 +1,249 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_ROLLING_ROWS_HPP
+#define VISTA_CIRCULAR_EXAMPLE_ROLLING_ROWS_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <vista/circular_array.hpp>
+#include <vista/span.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Row-major matrix with a fixed number of columns over contiguous memory.
+//
+// Element (r, c) is located at data[r * stride + c], so a column is accessed
+// with a stride of W elements.
+
+template <typename T, std::size_t W>
+struct row_block
+{
+    using value_type = T;
+    using size_type = std::size_t;
+    using row_type = span<T, W>;
+
+    static constexpr size_type stride = W;
+
+    size_type rows() const noexcept { return size; }
+    bool empty() const noexcept { return size == 0; }
+
+    row_type row(size_type r) const noexcept
+    {
+        assert(r < size);
+        return row_type(data + r * stride, W);
+    }
+
+    T& operator()(size_type r, size_type c) const noexcept
+    {
+        assert(r < size);
+        assert(c < W);
+        return data[r * stride + c];
+    }
+
+    T *data;
+    size_type size;
+};
+
+template <typename T, std::size_t W>
+constexpr std::size_t row_block<T, W>::stride;
+
+// Rolling buffer with the most recent R rows of W elements each, such as the
+// columns of a spectrogram or the scanlines of a camera.
+//
+// The rows are stored back-to-back in row-major order in a single circular
+// array of R * W elements. Rows are always inserted and removed as a whole, so
+// the circular array starts at a row boundary and a row is never split across
+// the wrap-around. Any range of rows therefore occupies at most two contiguous
+// blocks of the same underlying array that can be passed directly to matrix
+// kernels.
+//
+// The oldest row is overwritten when the buffer is full.
+
+template <typename T, std::size_t R, std::size_t W>
+class rolling_rows
+{
+    static_assert(R > 0, "R must be greater than zero");
+    static_assert(W > 0, "W must be greater than zero");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using row_type = span<value_type, W>;
+    using const_row_type = span<const value_type, W>;
+    using block_type = row_block<value_type, W>;
+    using const_block_type = row_block<const value_type, W>;
+
+    //! @brief Pair of row-major blocks ordered from oldest to newest row.
+
+    template <typename Block>
+    struct basic_segments
+    {
+        size_type rows() const noexcept { return first.rows() + second.rows(); }
+
+        Block first;
+        Block second;
+    };
+
+    using segments = basic_segments<block_type>;
+    using const_segments = basic_segments<const_block_type>;
+
+    //! @brief Number of elements between vertically adjacent elements.
+
+    static constexpr size_type column_stride = W;
+
+    //! @brief Checks if buffer is empty.
+
+    bool empty() const noexcept
+    {
+        return elements.empty();
+    }
+
+    //! @brief Checks if buffer is full.
+
+    bool full() const noexcept
+    {
+        return elements.full();
+    }
+
+    //! @brief Returns the maximum number of rows.
+
+    size_type capacity() const noexcept
+    {
+        return R;
+    }
+
+    //! @brief Returns the number of rows.
+
+    size_type size() const noexcept
+    {
+        return elements.size() / W;
+    }
+
+    //! @brief Returns row at position, where position 0 is the oldest row.
+    //!
+    //! @pre position < size()
+
+    row_type operator[](size_type position) noexcept
+    {
+        return row_type(&elements[position * W], W);
+    }
+
+    //! @brief Returns row at position, where position 0 is the oldest row.
+    //!
+    //! @pre position < size()
+
+    const_row_type operator[](size_type position) const noexcept
+    {
+        return const_row_type(&elements[position * W], W);
+    }
+
+    //! @brief Returns the newest row.
+    //!
+    //! @pre !empty()
+
+    row_type back() noexcept
+    {
+        return row_type(&elements[elements.size() - W], W);
+    }
+
+    //! @brief Appends row filled by the caller.
+    //!
+    //! The returned row has unspecified content and must be overwritten.
+    //! The oldest row is removed if the buffer is full.
+
+    row_type push_back() noexcept
+    {
+        // Takes the oldest row when full
+        elements.expand_back(W);
+        return back();
+    }
+
+    //! @brief Appends copy of row.
+    //!
+    //! The oldest row is removed if the buffer is full.
+
+    void push_back(const_row_type input) noexcept
+    {
+        auto row = push_back();
+        std::copy(input.begin(), input.end(), row.begin());
+    }
+
+    //! @brief Removes all rows.
+
+    void clear() noexcept
+    {
+        elements.clear();
+    }
+
+    //! @brief Returns blocks with the newest count rows.
+    //!
+    //! The second block is empty unless the rows wrap around.
+    //!
+    //! @pre count <= size()
+
+    segments last(size_type count) noexcept
+    {
+        return make_last<segments>(elements.first_segment(), elements.last_segment(), count);
+    }
+
+    //! @brief Returns blocks with the newest count rows.
+    //!
+    //! The second block is empty unless the rows wrap around.
+    //!
+    //! @pre count <= size()
+
+    const_segments last(size_type count) const noexcept
+    {
+        return make_last<const_segments>(elements.first_segment(), elements.last_segment(), count);
+    }
+
+private:
+    // Segments of the circular array always hold whole rows
+    template <typename Result, typename Segment>
+    static Result make_last(Segment head, Segment tail, size_type count) noexcept
+    {
+        const auto head_rows = head.size() / W;
+        const auto tail_rows = tail.size() / W;
+        assert(count <= head_rows + tail_rows);
+
+        if (count <= tail_rows)
+        {
+            return { { row_data(tail, tail_rows - count), count },
+                     { nullptr, 0 } };
+        }
+        const auto from_head = count - tail_rows;
+        return { { row_data(head, head_rows - from_head), from_head },
+                 { row_data(tail, 0), tail_rows } };
+    }
+
+    template <typename Segment>
+    static auto row_data(Segment segment, size_type row) noexcept -> decltype(segment.data())
+    {
+        return (row * W < segment.size()) ? segment.data() + row * W : nullptr;
+    }
+
+private:
+    circular_array<value_type, R * W> elements;
+};
+
+template <typename T, std::size_t R, std::size_t W>
+constexpr std::size_t rolling_rows<T, R, W>::column_stride;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_ROLLING_ROWS_HPP
@@ -0,0 +1,432 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_COMPRESSED_SERIES_HPP
+#define VISTA_CIRCULAR_EXAMPLE_COMPRESSED_SERIES_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <vista/circular_array.hpp>
+#include <vista/detail/bit.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+struct sample
+{
+    std::int64_t timestamp;
+    double value;
+};
+
+// Compressed time-series with a moving window over the most recent samples.
+//
+// Samples are compressed as described in "Gorilla: A Fast, Scalable,
+// In-Memory Time Series Database" (Pelkonen et al., 2015). Timestamps are
+// encoded as delta-of-deltas, and values are encoded as the XOR with the
+// previous value.
+//
+// Samples are appended to fixed-size blocks, and the blocks are kept in a
+// circular array. When the circular array is full, the oldest block is
+// evicted as a whole to make room for a new block.
+//
+// Samples are decoded in a streaming fashion by iterating over the series.
+
+template <std::size_t Blocks, std::size_t BlockWords = 32>
+class compressed_series
+{
+    using word_type = std::uint64_t;
+    using size_type = std::size_t;
+
+    static constexpr size_type word_bits = 64;
+    // Control bits and payload for the worst-case timestamp and value
+    static constexpr size_type max_sample_bits = (4 + 64) + (2 + 5 + 6 + 64);
+
+    static_assert(Blocks > 0, "Blocks must be greater than zero");
+    static_assert(BlockWords * word_bits >= max_sample_bits, "BlockWords is too small");
+
+    struct block
+    {
+        std::int64_t first_timestamp = 0;
+        word_type first_value = 0;
+        size_type count = 0;
+        size_type bits = 0;
+        word_type words[BlockWords];
+    };
+
+    // Running state shared by encoder and decoder
+    struct codec_state
+    {
+        std::int64_t timestamp = 0;
+        std::int64_t delta = 0;
+        word_type value = 0;
+        int leading = word_bits; // No previous window
+        int trailing = 0;
+    };
+
+public:
+    using value_type = sample;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = sample;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const sample*;
+        using reference = const sample&;
+
+        const_iterator() noexcept = default;
+
+        reference operator*() const noexcept { return current; }
+        pointer operator->() const noexcept { return &current; }
+
+        const_iterator& operator++() noexcept
+        {
+            ++position;
+            if (position < parent->blocks[which].count)
+            {
+                decode();
+            }
+            else
+            {
+                ++which;
+                start();
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto before = *this;
+            ++*this;
+            return before;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept
+        {
+            return which == other.which && position == other.position;
+        }
+
+        bool operator!=(const const_iterator& other) const noexcept
+        {
+            return !operator==(other);
+        }
+
+    private:
+        friend class compressed_series;
+
+        const_iterator(const compressed_series *parent, size_type which) noexcept
+            : parent(parent),
+              which(which)
+        {
+            start();
+        }
+
+        void start() noexcept
+        {
+            position = 0;
+            if (which < parent->blocks.size())
+            {
+                const block& current_block = parent->blocks[which];
+                state = codec_state{};
+                state.timestamp = current_block.first_timestamp;
+                state.value = current_block.first_value;
+                bit = 0;
+                update();
+            }
+        }
+
+        void decode() noexcept
+        {
+            parent->decode(parent->blocks[which], bit, state);
+            update();
+        }
+
+        void update() noexcept
+        {
+            current.timestamp = state.timestamp;
+            std::memcpy(&current.value, &state.value, sizeof(current.value));
+        }
+
+        const compressed_series *parent = nullptr;
+        size_type which = 0;
+        size_type position = 0;
+        size_type bit = 0;
+        codec_state state;
+        sample current = {};
+    };
+
+    using iterator = const_iterator;
+
+    compressed_series() = default;
+
+    //! @brief Checks if the series is empty.
+
+    bool empty() const noexcept
+    {
+        return blocks.empty();
+    }
+
+    //! @brief Returns the number of samples in the series.
+
+    size_type size() const noexcept
+    {
+        return samples;
+    }
+
+    //! @brief Returns the number of bytes used by the encoded samples.
+
+    size_type encoded_size() const noexcept
+    {
+        size_type result = 0;
+        for (const auto& current : blocks)
+        {
+            result += (current.bits + 7) / 8 + sizeof(current.first_timestamp) + sizeof(current.first_value);
+        }
+        return result;
+    }
+
+    //! @brief Appends sample.
+    //!
+    //! The oldest block of samples is evicted if there is no room for the
+    //! sample.
+
+    void push_back(std::int64_t timestamp, double value) noexcept
+    {
+        word_type bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        if (blocks.empty() || (blocks.back().bits + max_sample_bits > BlockWords * word_bits))
+        {
+            if (blocks.full())
+            {
+                samples -= blocks.front().count;
+            }
+            // Evicts the oldest block when full
+            blocks.expand_back();
+            block& current = blocks.back();
+            current.first_timestamp = timestamp;
+            current.first_value = bits;
+            current.count = 1;
+            current.bits = 0;
+            encoder = codec_state{};
+            encoder.timestamp = timestamp;
+            encoder.value = bits;
+        }
+        else
+        {
+            block& current = blocks.back();
+            encode(current, timestamp, bits);
+            ++current.count;
+        }
+        ++samples;
+    }
+
+    //! @brief Returns iterator to the oldest sample.
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    //! @brief Returns iterator to the end of the series.
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, blocks.size());
+    }
+
+    //! @brief Returns iterator to first sample not older than timestamp.
+    //!
+    //! Blocks that only contain older samples are skipped without decoding.
+    //!
+    //! @pre Timestamps are non-decreasing.
+
+    const_iterator find(std::int64_t timestamp) const noexcept
+    {
+        size_type which = 0;
+        while (which + 1 < blocks.size() && blocks[which + 1].first_timestamp <= timestamp)
+        {
+            ++which;
+        }
+        const_iterator result(this, which);
+        const auto last = end();
+        while (result != last && result->timestamp < timestamp)
+        {
+            ++result;
+        }
+        return result;
+    }
+
+private:
+    void encode(block& current, std::int64_t timestamp, word_type bits) noexcept
+    {
+        // Delta-of-delta timestamp
+        const std::int64_t delta = timestamp - encoder.timestamp;
+        const std::int64_t dod = delta - encoder.delta;
+        if (dod == 0)
+        {
+            write(current, 0x0, 1);
+        }
+        else if (fits(dod, 7))
+        {
+            write(current, 0x1, 2);
+            write(current, word_type(dod), 7);
+        }
+        else if (fits(dod, 9))
+        {
+            write(current, 0x3, 3);
+            write(current, word_type(dod), 9);
+        }
+        else if (fits(dod, 12))
+        {
+            write(current, 0x7, 4);
+            write(current, word_type(dod), 12);
+        }
+        else
+        {
+            write(current, 0xF, 4);
+            write(current, word_type(dod), 64);
+        }
+        encoder.timestamp = timestamp;
+        encoder.delta = delta;
+
+        // XOR value
+        const word_type difference = bits ^ encoder.value;
+        if (difference == 0)
+        {
+            write(current, 0x0, 1);
+        }
+        else
+        {
+            int leading = vista::detail::countl_zero(difference);
+            leading = (leading > 31) ? 31 : leading;
+            const int trailing = vista::detail::countr_zero(difference);
+            if (leading >= encoder.leading && trailing >= encoder.trailing)
+            {
+                // Reuse previous window
+                write(current, 0x1, 2);
+                write(current, difference >> encoder.trailing, word_bits - encoder.leading - encoder.trailing);
+            }
+            else
+            {
+                const int meaningful = word_bits - leading - trailing;
+                write(current, 0x3, 2);
+                write(current, word_type(leading), 5);
+                write(current, word_type(meaningful) & 0x3F, 6);
+                write(current, difference >> trailing, meaningful);
+                encoder.leading = leading;
+                encoder.trailing = trailing;
+            }
+        }
+        encoder.value = bits;
+    }
+
+    void decode(const block& current, size_type& bit, codec_state& state) const noexcept
+    {
+        // Delta-of-delta timestamp
+        std::int64_t dod = 0;
+        if (read(current, bit, 1))
+        {
+            if (!read(current, bit, 1))
+                dod = extend(read(current, bit, 7), 7);
+            else if (!read(current, bit, 1))
+                dod = extend(read(current, bit, 9), 9);
+            else if (!read(current, bit, 1))
+                dod = extend(read(current, bit, 12), 12);
+            else
+                dod = std::int64_t(read(current, bit, 64));
+        }
+        state.delta += dod;
+        state.timestamp += state.delta;
+
+        // XOR value
+        if (read(current, bit, 1))
+        {
+            if (read(current, bit, 1))
+            {
+                state.leading = int(read(current, bit, 5));
+                int meaningful = int(read(current, bit, 6));
+                meaningful = (meaningful == 0) ? word_bits : meaningful;
+                state.trailing = word_bits - state.leading - meaningful;
+            }
+            const int meaningful = word_bits - state.leading - state.trailing;
+            state.value ^= read(current, bit, meaningful) << state.trailing;
+        }
+    }
+
+    static bool fits(std::int64_t value, int bits) noexcept
+    {
+        const std::int64_t limit = std::int64_t(1) << (bits - 1);
+        return (value >= -limit) && (value < limit);
+    }
+
+    static std::int64_t extend(word_type value, int bits) noexcept
+    {
+        const word_type sign = word_type(1) << (bits - 1);
+        return std::int64_t(value ^ sign) - std::int64_t(sign);
+    }
+
+    static word_type mask(int bits) noexcept
+    {
+        return (bits < int(word_bits)) ? (word_type(1) << bits) - 1 : ~word_type(0);
+    }
+
+    static void write(block& current, word_type value, int count) noexcept
+    {
+        assert(current.bits + count <= BlockWords * word_bits);
+
+        value &= mask(count);
+        const auto offset = current.bits % word_bits;
+        const auto index = current.bits / word_bits;
+        current.words[index] = (current.words[index] & mask(int(offset))) | (value << offset);
+        if (offset + count > word_bits)
+        {
+            current.words[index + 1] = value >> (word_bits - offset);
+        }
+        current.bits += count;
+    }
+
+    static word_type read(const block& current, size_type& bit, int count) noexcept
+    {
+        const auto offset = bit % word_bits;
+        const auto index = bit / word_bits;
+        word_type result = current.words[index] >> offset;
+        if (offset + count > word_bits)
+        {
+            result |= current.words[index + 1] << (word_bits - offset);
+        }
+        bit += count;
+        return result & mask(count);
+    }
+
+private:
+    circular_array<block, Blocks> blocks;
+    codec_state encoder;
+    size_type samples = 0;
+};
+
+template <std::size_t Blocks, std::size_t BlockWords>
+constexpr std::size_t compressed_series<Blocks, BlockWords>::word_bits;
+
+template <std::size_t Blocks, std::size_t BlockWords>
+constexpr std::size_t compressed_series<Blocks, BlockWords>::max_sample_bits;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_COMPRESSED_SERIES_HPP
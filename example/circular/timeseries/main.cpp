@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include "compressed_series.hpp"
+
+using namespace vista::circular::example;
+
+int main()
+{
+    // Slowly changing samples at almost regular intervals
+    std::vector<sample> input;
+    std::int64_t timestamp = 1600000000000;
+    for (int k = 0; k < 10000; ++k)
+    {
+        timestamp += 1000 + ((k % 7 == 0) ? 3 : 0) - ((k % 11 == 0) ? 2 : 0);
+        const double value = (k % 100 < 50) ? 42.0 : 42.0 + (k % 13) * 0.25;
+        input.push_back({ timestamp, value });
+    }
+    // Irregular outliers
+    input.push_back({ timestamp + 123456789, -1.0e300 });
+    input.push_back({ timestamp + 123456790, 0.0 });
+
+    // Everything fits
+    {
+        compressed_series<64> series;
+        assert(series.empty());
+        assert(series.begin() == series.end());
+        for (const auto& current : input)
+        {
+            series.push_back(current.timestamp, current.value);
+        }
+        assert(series.size() == input.size());
+        // Far less than 16 bytes per sample
+        assert(series.encoded_size() * 5 < input.size() * sizeof(sample));
+
+        auto expect = input.begin();
+        for (auto current = series.begin(); current != series.end(); ++current, ++expect)
+        {
+            assert(current->timestamp == expect->timestamp);
+            assert(current->value == expect->value);
+        }
+        assert(expect == input.end());
+
+        auto where = series.find(input[5000].timestamp);
+        assert(where->timestamp == input[5000].timestamp);
+        where = series.find(input[5000].timestamp - 1);
+        assert(where->timestamp == input[5000].timestamp);
+        where = series.find(input.back().timestamp + 1);
+        assert(where == series.end());
+    }
+
+    // Oldest blocks are evicted
+    {
+        compressed_series<4, 8> series;
+        for (const auto& current : input)
+        {
+            series.push_back(current.timestamp, current.value);
+        }
+        assert(series.size() < input.size());
+
+        auto expect = input.end() - series.size();
+        for (auto current = series.begin(); current != series.end(); ++current, ++expect)
+        {
+            assert(current->timestamp == expect->timestamp);
+            assert(current->value == expect->value);
+        }
+        assert(expect == input.end());
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <vector>
+#include "timing_wheel.hpp"
+
+using namespace vista::circular::example;
+
+struct task : timer
+{
+    int id = 0;
+    std::vector<timer::time_type> fired;
+};
+
+int main()
+{
+    // Small wheel with 4 slots per level to exercise cascading
+    using wheel_type = timing_wheel<3, 2>;
+    static_assert(wheel_type::slots == 4, "");
+
+    // Timers at every level and beyond the span of the wheel
+    {
+        wheel_type wheel;
+        std::vector<task> tasks(7);
+        const timer::time_type expiries[] = { 1, 3, 4, 13, 17, 64, 200 };
+        for (int k = 0; k < 7; ++k)
+        {
+            tasks[k].id = k;
+            wheel.schedule(tasks[k], expiries[k]);
+        }
+        assert(wheel.size() == 7);
+
+        std::vector<int> order;
+        auto record = [&wheel, &order] (timer& entry) {
+            auto& current = static_cast<task&>(entry);
+            assert(!current.scheduled());
+            current.fired.push_back(wheel.now());
+            order.push_back(current.id);
+        };
+        // Advancing must not be placed inside assert
+        auto fired = wheel.advance(3, record);
+        assert(fired == 2);
+        fired = wheel.advance(100, record);
+        assert(fired == 4);
+        assert(wheel.size() == 1);
+        fired = wheel.advance(1000, record);
+        assert(fired == 1);
+        (void)fired;
+        assert(wheel.empty());
+        assert(wheel.now() == 1000);
+
+        for (int k = 0; k < 7; ++k)
+        {
+            assert(order[k] == k);
+            assert(tasks[k].fired.size() == 1);
+            assert(tasks[k].fired[0] == expiries[k]);
+        }
+    }
+    // Cancellation
+    {
+        wheel_type wheel(10);
+        task first;
+        task second;
+        wheel.schedule(first, 20);
+        wheel.schedule(second, 20);
+        wheel.cancel(first);
+        assert(!first.scheduled());
+        assert(wheel.size() == 1);
+        // Cancelling unscheduled timer does nothing
+        wheel.cancel(first);
+        assert(wheel.size() == 1);
+        int fired = 0;
+        wheel.advance(30, [&fired] (timer&) { ++fired; });
+        assert(fired == 1);
+    }
+    // Periodic timer rescheduled from within the callback
+    {
+        wheel_type wheel;
+        task periodic;
+        wheel.schedule(periodic, 7);
+        wheel.advance(100, [&wheel] (timer& entry) {
+            auto& current = static_cast<task&>(entry);
+            current.fired.push_back(wheel.now());
+            wheel.schedule(current, wheel.now() + 7);
+        });
+        assert(periodic.fired.size() == 14);
+        assert(periodic.fired.back() == 98);
+        assert(periodic.scheduled());
+    }
+    // Expired timers in the same batch can be cancelled by the callback
+    {
+        wheel_type wheel;
+        task first;
+        task second;
+        wheel.schedule(first, 5);
+        wheel.schedule(second, 5);
+        int fired = 0;
+        wheel.advance(10, [&] (timer& entry) {
+            ++fired;
+            wheel.cancel(&entry == &first ? second : first);
+        });
+        assert(fired == 1);
+        assert(wheel.empty());
+    }
+    // Timers scheduled in the past fire on the next tick
+    {
+        wheel_type wheel(50);
+        task late;
+        wheel.schedule(late, 40);
+        wheel.advance(51, [&wheel] (timer&) { assert(wheel.now() == 51); });
+        assert(!late.scheduled());
+    }
+    return 0;
+}
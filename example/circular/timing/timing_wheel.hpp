@@ -0,0 +1,289 @@
+#ifndef VISTA_CIRCULAR_EXAMPLE_TIMING_WHEEL_HPP
+#define VISTA_CIRCULAR_EXAMPLE_TIMING_WHEEL_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vista/circular_array.hpp>
+
+namespace vista
+{
+namespace circular
+{
+namespace example
+{
+
+// Intrusive timer entry.
+//
+// Timers are owned by the user and linked into the buckets of the timing
+// wheel, so scheduling never allocates. A timer must outlive its scheduling.
+
+struct timer
+{
+    using time_type = std::int64_t;
+
+    bool scheduled() const noexcept
+    {
+        return link != nullptr;
+    }
+
+    time_type expiry = 0;
+    timer *next = nullptr;
+    // Pointer to the pointer that points to this timer
+    timer **link = nullptr;
+};
+
+// Hierarchical timing wheel.
+//
+// Timers are hashed into buckets by expiry as described in "Hashed and
+// Hierarchical Timing Wheels" (Varghese and Lauck, 1987). Each level is a
+// circular array of buckets, where a bucket at level L spans Slots^L ticks.
+// The first bucket of each level is the next one to expire, and the wheel is
+// turned by recycling the drained first bucket as the last bucket.
+//
+// When a bucket at a coarser level becomes due, its timers are cascaded into
+// the finer levels. Timers beyond the span of the coarsest level are parked
+// in its last bucket and cascaded until they come within range.
+//
+// Scheduling and cancellation take constant time. Advancing the clock takes
+// constant time per tick plus the time to fire or cascade timers.
+//
+// Time is measured in non-negative ticks.
+
+template <std::size_t Levels = 4, std::size_t SlotBits = 8>
+class timing_wheel
+{
+public:
+    using time_type = timer::time_type;
+    using size_type = std::size_t;
+
+    static constexpr size_type levels = Levels;
+    static constexpr size_type slots = size_type(1) << SlotBits;
+
+    static_assert(Levels > 0, "Levels must be greater than zero");
+    static_assert(SlotBits * Levels < 63, "Wheel span exceeds time_type");
+
+    //! @brief Creates timing wheel with current time.
+    //!
+    //! @pre now >= 0
+
+    explicit timing_wheel(time_type now = 0) noexcept
+        : current(now)
+    {
+        assert(now >= 0);
+        for (auto& wheel : wheels)
+        {
+            wheel.expand_back(slots);
+        }
+    }
+
+    // Timers point into the buckets
+    timing_wheel(const timing_wheel&) = delete;
+    timing_wheel& operator=(const timing_wheel&) = delete;
+
+    //! @brief Returns the current time.
+
+    time_type now() const noexcept
+    {
+        return current;
+    }
+
+    //! @brief Returns the number of scheduled timers.
+
+    size_type size() const noexcept
+    {
+        return count;
+    }
+
+    //! @brief Checks if no timers are scheduled.
+
+    bool empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    //! @brief Schedules timer to fire at expiry.
+    //!
+    //! A timer that has already expired fires on the next advance.
+    //!
+    //! @pre !entry.scheduled()
+
+    void schedule(timer& entry, time_type expiry) noexcept
+    {
+        assert(!entry.scheduled());
+        entry.expiry = expiry;
+        insert(entry);
+        ++count;
+    }
+
+    //! @brief Cancels timer.
+    //!
+    //! Does nothing if the timer is not scheduled.
+
+    void cancel(timer& entry) noexcept
+    {
+        if (!entry.scheduled())
+            return;
+        unlink(entry);
+        --count;
+    }
+
+    //! @brief Advances the current time and fires expired timers.
+    //!
+    //! The function is called with each expired timer, one tick at a time.
+    //! The timer is no longer scheduled when the function is called, so the
+    //! function may schedule it again. The function may also schedule or
+    //! cancel other timers.
+    //!
+    //! Returns the number of fired timers.
+
+    template <typename Function>
+    size_type advance(time_type now, Function&& function)
+    {
+        size_type fired = 0;
+        while (current < now)
+        {
+            if (empty())
+            {
+                // Nothing to turn
+                current = now;
+                break;
+            }
+            tick();
+            while (pending.head)
+            {
+                timer& entry = *pending.head;
+                unlink(entry);
+                --count;
+                ++fired;
+                function(entry);
+            }
+        }
+        return fired;
+    }
+
+private:
+    struct bucket
+    {
+        timer *head = nullptr;
+    };
+
+    using wheel_type = circular_array<bucket, slots>;
+
+    static constexpr size_type shift(size_type level) noexcept
+    {
+        return SlotBits * level;
+    }
+
+    static void link(bucket& where, timer& entry) noexcept
+    {
+        entry.next = where.head;
+        if (entry.next)
+        {
+            entry.next->link = &entry.next;
+        }
+        where.head = &entry;
+        entry.link = &where.head;
+    }
+
+    static void unlink(timer& entry) noexcept
+    {
+        *entry.link = entry.next;
+        if (entry.next)
+        {
+            entry.next->link = entry.link;
+        }
+        entry.next = nullptr;
+        entry.link = nullptr;
+    }
+
+    // The first bucket at the finest level is the next tick, and the first
+    // bucket at coarser levels spans the block after the block of the next
+    // tick.
+    void insert(timer& entry) noexcept
+    {
+        const time_type next = current + 1;
+        for (size_type level = 0; level < levels; ++level)
+        {
+            const time_type offset = (entry.expiry >> shift(level)) - (next >> shift(level)) - ((level == 0) ? 0 : 1);
+            if (offset < time_type(slots))
+            {
+                link(wheels[level][(offset < 0) ? 0 : size_type(offset)], entry);
+                return;
+            }
+        }
+        link(wheels[levels - 1].back(), entry);
+    }
+
+    // Drains the first bucket and turns the wheel by one bucket.
+    static timer *turn(wheel_type& wheel) noexcept
+    {
+        timer *result = wheel.front().head;
+        wheel.front().head = nullptr;
+        wheel.expand_back();
+        return result;
+    }
+
+    void tick() noexcept
+    {
+        ++current;
+
+        // Move expired timers to pending before turning the wheel
+        assert(!pending.head);
+        pending.head = turn(wheels[0]);
+        if (pending.head)
+        {
+            pending.head->link = &pending.head;
+        }
+
+        // Coarser buckets that become due on the next tick are cascaded into
+        // the finer levels. All due wheels are turned before any timer is
+        // inserted again.
+        const time_type next = current + 1;
+        timer *due[levels] = {};
+        for (size_type level = 1; level < levels; ++level)
+        {
+            if ((next & ((time_type(1) << shift(level)) - 1)) != 0)
+                break;
+            due[level] = turn(wheels[level]);
+        }
+        for (size_type level = 1; level < levels; ++level)
+        {
+            timer *entry = due[level];
+            while (entry)
+            {
+                timer *following = entry->next;
+                insert(*entry);
+                entry = following;
+            }
+        }
+    }
+
+private:
+    std::array<wheel_type, Levels> wheels;
+    bucket pending;
+    time_type current;
+    size_type count = 0;
+};
+
+template <std::size_t Levels, std::size_t SlotBits>
+constexpr std::size_t timing_wheel<Levels, SlotBits>::levels;
+
+template <std::size_t Levels, std::size_t SlotBits>
+constexpr std::size_t timing_wheel<Levels, SlotBits>::slots;
+
+} // namespace example
+} // namespace circular
+} // namespace vista
+
+#endif // VISTA_CIRCULAR_EXAMPLE_TIMING_WHEEL_HPP
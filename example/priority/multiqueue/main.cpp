@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string> // std::stoul
+#include <thread>
+#include <vector>
+#include "multiqueue.hpp"
+
+constexpr std::size_t threads = 4;
+constexpr std::size_t amount = 10000;
+
+// Min-queue of task identifiers
+using multiqueue = vista::priority::example::multiqueue<std::uint32_t, 2 * threads, amount, vista::greater<std::uint32_t>>;
+
+void single_threaded_rank(multiqueue& queue)
+{
+    // Smallest elements are removed approximately in order
+    for (std::uint32_t k = 0; k < amount; ++k)
+    {
+        queue.push(k);
+    }
+    std::set<std::uint32_t> remaining;
+    for (std::uint32_t k = 0; k < amount; ++k)
+    {
+        remaining.insert(k);
+    }
+    std::size_t total_rank = 0;
+    std::uint32_t value = 0;
+    while (queue.try_pop(value))
+    {
+        auto where = remaining.find(value);
+        assert(where != remaining.end());
+        total_rank += std::distance(remaining.begin(), where);
+        remaining.erase(where);
+    }
+    assert(remaining.empty());
+    assert(queue.empty());
+
+    const double mean_rank = double(total_rank) / amount;
+    std::cout << "mean rank error = " << mean_rank << std::endl;
+    assert(mean_rank < multiqueue::shard_count * 4);
+}
+
+void multi_threaded_exchange(multiqueue& queue)
+{
+    // Producers insert disjoint ranges, consumers collect everything once
+    std::vector<std::vector<std::uint32_t>> popped(threads);
+    std::atomic<std::size_t> remaining{amount};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&queue, t] {
+            const auto per_thread = amount / threads;
+            for (std::uint32_t k = 0; k < per_thread; ++k)
+            {
+                const bool inserted = queue.push(std::uint32_t(t * per_thread + k));
+                assert(inserted);
+                (void)inserted;
+            }
+        });
+        workers.emplace_back([&queue, &popped, &remaining, t] {
+            std::uint32_t value = 0;
+            while (remaining.load() > 0)
+            {
+                if (queue.try_pop(value))
+                {
+                    popped[t].push_back(value);
+                    --remaining;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::vector<bool> seen(amount, false);
+    for (const auto& values : popped)
+    {
+        for (auto value : values)
+        {
+            assert(value < amount);
+            assert(!seen[value]);
+            seen[value] = true;
+        }
+    }
+    for (bool value : seen)
+    {
+        assert(value);
+        (void)value;
+    }
+    assert(queue.empty());
+}
+
+int main()
+{
+    // Shards are large, so allocate outside the stack
+    std::unique_ptr<multiqueue> queue(new multiqueue);
+    single_threaded_rank(*queue);
+    multi_threaded_exchange(*queue);
+    return 0;
+}
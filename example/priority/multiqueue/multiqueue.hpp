@@ -0,0 +1,225 @@
+#ifndef VISTA_PRIORITY_EXAMPLE_MULTIQUEUE_HPP
+#define VISTA_PRIORITY_EXAMPLE_MULTIQUEUE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vista/functional.hpp>
+#include <vista/priority_view.hpp>
+
+namespace vista
+{
+namespace priority
+{
+namespace example
+{
+
+// Relaxed concurrent priority queue.
+//
+// The elements are spread over several shards, where each shard is a priority
+// view guarded by a spin lock, as described in "MultiQueues: Simple Relaxed
+// Concurrent Priority Queues" (Rihani et al., 2015).
+//
+// Insertion locks a random shard. Removal samples two random shards, and
+// locks the one with the better topmost element. Threads therefore rarely
+// contend for the same lock, at the cost of not always removing the best
+// element. The expected rank of the removed element is proportional to the
+// number of shards.
+//
+// The topmost element of each shard is cached so shards can be sampled without
+// locking. The element type must therefore be trivially copyable, such as a
+// priority and a task identifier packed into an integer.
+//
+// The number of shards is typically a small multiple of the number of threads.
+
+template <typename T,
+          std::size_t Shards,
+          std::size_t ShardCapacity,
+          typename Compare = vista::less<T>>
+class multiqueue
+{
+    static_assert(Shards >= 2, "Shards must be at least two");
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type shard_count = Shards;
+
+    multiqueue() = default;
+    multiqueue(const multiqueue&) = delete;
+    multiqueue& operator=(const multiqueue&) = delete;
+
+    //! @brief Returns the maximum possible number of elements.
+
+    static constexpr size_type capacity() noexcept
+    {
+        return Shards * ShardCapacity;
+    }
+
+    //! @brief Inserts element into a random shard.
+    //!
+    //! Returns false if the element could not be inserted because the sampled
+    //! shards are full.
+
+    bool push(value_type input) noexcept
+    {
+        for (size_type attempt = 0; attempt < Shards; )
+        {
+            shard& current = shards[random() % Shards];
+            if (!current.try_lock())
+                continue;
+            if (current.heap.full())
+            {
+                current.unlock();
+                ++attempt;
+                continue;
+            }
+            current.heap.push(input);
+            current.update();
+            current.unlock();
+            return true;
+        }
+        return false;
+    }
+
+    //! @brief Removes an element with high priority.
+    //!
+    //! The better of the topmost elements of two random shards is removed.
+    //!
+    //! Returns false if the multiqueue is empty.
+
+    bool try_pop(value_type& output) noexcept
+    {
+        while (true)
+        {
+            const auto first = random() % Shards;
+            auto second = random() % (Shards - 1);
+            second += (second >= first) ? 1 : 0;
+
+            shard *chosen = choose(shards[first], shards[second]);
+            if (!chosen)
+            {
+                // Both samples are empty
+                if (empty())
+                    return false;
+                continue;
+            }
+            if (!chosen->try_lock())
+                continue;
+            if (chosen->heap.empty())
+            {
+                chosen->unlock();
+                continue;
+            }
+            output = chosen->heap.top();
+            chosen->heap.pop();
+            chosen->update();
+            chosen->unlock();
+            return true;
+        }
+    }
+
+    //! @brief Checks if all shards are empty.
+    //!
+    //! The result may be outdated if other threads modify the multiqueue.
+
+    bool empty() const noexcept
+    {
+        for (const auto& current : shards)
+        {
+            if (current.occupied.load(std::memory_order_acquire))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    struct shard
+    {
+        shard() noexcept
+            : heap(storage.data(), storage.size())
+        {
+        }
+
+        bool try_lock() noexcept
+        {
+            return !lock.test_and_set(std::memory_order_acquire);
+        }
+
+        void unlock() noexcept
+        {
+            lock.clear(std::memory_order_release);
+        }
+
+        // Publishes the topmost element while locked
+        void update() noexcept
+        {
+            if (!heap.empty())
+            {
+                top.store(heap.top(), std::memory_order_relaxed);
+            }
+            occupied.store(!heap.empty(), std::memory_order_release);
+        }
+
+        std::atomic_flag lock = ATOMIC_FLAG_INIT;
+        std::atomic<bool> occupied{false};
+        std::atomic<value_type> top{value_type{}};
+        std::array<value_type, ShardCapacity> storage;
+        priority_view<value_type, ShardCapacity, Compare> heap;
+    };
+
+    // Picks the shard with the better cached topmost element
+    shard *choose(shard& first, shard& second) const noexcept
+    {
+        const bool has_first = first.occupied.load(std::memory_order_acquire);
+        const bool has_second = second.occupied.load(std::memory_order_acquire);
+        if (!has_first)
+            return has_second ? &second : nullptr;
+        if (!has_second)
+            return &first;
+        return Compare{}(first.top.load(std::memory_order_relaxed),
+                         second.top.load(std::memory_order_relaxed))
+            ? &second
+            : &first;
+    }
+
+    // Per-thread xorshift generator
+    static std::uint32_t random() noexcept
+    {
+        static thread_local std::uint32_t state = 0;
+        if (state == 0)
+        {
+            // Seed from the address of the thread-local state
+            state = std::uint32_t(reinterpret_cast<std::uintptr_t>(&state) >> 4) | 1U;
+        }
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+private:
+    std::array<shard, Shards> shards;
+};
+
+template <typename T, std::size_t Shards, std::size_t ShardCapacity, typename Compare>
+constexpr std::size_t multiqueue<T, Shards, ShardCapacity, Compare>::shard_count;
+
+} // namespace example
+} // namespace priority
+} // namespace vista
+
+#endif // VISTA_PRIORITY_EXAMPLE_MULTIQUEUE_HPP
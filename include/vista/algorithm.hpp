@@ -49,7 +49,16 @@ template <typename RandomAccessIterator,
 VISTA_CXX14_CONSTEXPR
 void push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
 
+//! @brief Constexpr push_heap for d-ary heap.
+//!
+//! Each element has up to Arity children. Higher arity reduces the depth of
+//! the heap, so fewer levels are visited on each operation.
+//!
+//! @pre is_heap<Arity>(first, last - 1)
+//! @post is_heap<Arity>(first, last)
+
 template <bool WithConstexpr,
+          std::size_t Arity = 2,
           typename RandomAccessIterator,
           typename Compare>
 VISTA_CXX14_CONSTEXPR
@@ -74,12 +83,137 @@ template <typename RandomAccessIterator,
 VISTA_CXX14_CONSTEXPR
 void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
 
+//! @brief Constexpr pop_heap for d-ary heap.
+//!
+//! Each element has up to Arity children. Higher arity reduces the depth of
+//! the heap, but more children are compared at each level.
+//!
+//! @pre is_heap<Arity>(first, last)
+//! @post is_heap<Arity>(first, last - 1)
+
 template <bool WithConstexpr,
+          std::size_t Arity = 2,
           typename RandomAccessIterator,
           typename Compare>
 VISTA_CXX14_CONSTEXPR
 void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
 
+//! @brief Constexpr std::make_heap
+//!
+//! Linear time complexity.
+//!
+//! @post is_heap(first, last)
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+void make_heap(RandomAccessIterator first, RandomAccessIterator last);
+
+//! @brief Constexpr std::make_heap
+//!
+//! Linear time complexity.
+//!
+//! @post is_heap(first, last, comp)
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+//! @brief Constexpr make_heap for d-ary heap.
+//!
+//! Uses Floyd's algorithm which sifts down each non-leaf element starting
+//! from the last non-leaf element.
+//!
+//! Linear time complexity.
+//!
+//! @post is_heap<Arity>(first, last, comp)
+
+template <bool WithConstexpr,
+          std::size_t Arity = 2,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+//! @brief Constexpr std::is_heap_until
+//!
+//! Returns iterator to the first element that violates the heap property, or
+//! last if the entire range is a heap.
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator is_heap_until(RandomAccessIterator first, RandomAccessIterator last);
+
+//! @brief Constexpr std::is_heap_until
+//!
+//! Returns iterator to the first element that violates the heap property, or
+//! last if the entire range is a heap.
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator is_heap_until(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+//! @brief Constexpr is_heap_until for d-ary heap.
+
+template <std::size_t Arity,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator is_heap_until(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+//! @brief Constexpr std::is_heap
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+bool is_heap(RandomAccessIterator first, RandomAccessIterator last);
+
+//! @brief Constexpr std::is_heap
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+bool is_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+//! @brief Constexpr is_heap for d-ary heap.
+
+template <std::size_t Arity,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+bool is_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+//! @brief Constexpr std::sort_heap
+//!
+//! @pre is_heap(first, last)
+//! @post is_sorted(first, last)
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+void sort_heap(RandomAccessIterator first, RandomAccessIterator last);
+
+//! @brief Constexpr std::sort_heap
+//!
+//! @pre is_heap(first, last, comp)
+//! @post is_sorted(first, last, comp)
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+//! @brief Constexpr sort_heap for d-ary heap.
+//!
+//! @pre is_heap<Arity>(first, last, comp)
+//! @post is_sorted(first, last, comp)
+
+template <bool WithConstexpr,
+          std::size_t Arity = 2,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
 //-----------------------------------------------------------------------------
 // Sorted algorithms
 //-----------------------------------------------------------------------------
@@ -116,6 +250,38 @@ RandomAccessIterator lower_bound_sorted(RandomAccessIterator first,
                                         const T& needle,
                                         Compare compare) noexcept;
 
+//! @brief Returns position after where element is or would have been.
+//!
+//! Optimized version for sorted random-access range.
+//!
+//! Logarithmic time complexity.
+//!
+//! @pre is_sorted(first, last)
+
+template <typename RandomAccessIterator,
+          typename T>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator upper_bound_sorted(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T& needle) noexcept;
+
+//! @brief Returns position after where element is or would have been.
+//!
+//! Optimized version for sorted random-access range.
+//!
+//! Logarithmic time complexity.
+//!
+//! @pre is_sorted(first, last)
+
+template <typename RandomAccessIterator,
+          typename T,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator upper_bound_sorted(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T& needle,
+                                        Compare compare) noexcept;
+
 //! @brief Inserts trailing element into sorted range.
 //!
 //! Assumes that all elements in the range are sorted except for the trailing
@@ -24,15 +24,18 @@ namespace vista
 //! Capacity is the maximum number of elements that can be inserted without
 //! overwriting old elements. Capacity cannot be changed.
 //!
+//! The Evictor decides what happens when an element is inserted into a full
+//! circular array. See circular_view for details.
+//!
 //! Violation of any precondition results in undefined behavior.
 
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename Evictor = overwrite_evictor>
 class circular_array
     : private std::array<T, N>,
-      private circular_view<T, N>
+      private circular_view<T, N, Evictor>
 {
     using storage = std::array<T, N>;
-    using view = circular_view<T, N>;
+    using view = circular_view<T, N, Evictor>;
 
     static_assert(std::is_destructible<T>::value, "T must be Erasable");
     static_assert(std::is_default_constructible<T>::value, "T must be DefaultConstructible");
@@ -50,6 +53,7 @@ public:
     using const_reverse_iterator = typename view::const_reverse_iterator;
     using segment = typename view::segment;
     using const_segment = typename view::const_segment;
+    using evictor_type = typename view::evictor_type;
 
     //! @brief Creates empty circular array.
     //!
@@ -112,7 +116,7 @@ public:
     //! @post size() == input.size()
 
     VISTA_CXX14_CONSTEXPR
-    circular_array& operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+    circular_array& operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
     //! @brief Checks if circular array is empty.
     using view::empty;
@@ -126,6 +130,9 @@ public:
     //! @brief Returns the number of elements in circular array.
     using view::size;
 
+    //! @brief Returns the eviction policy.
+    using view::evictor;
+
     //! @brief Returns the maximum number of possible elements in circular array.
     constexpr size_type max_size() const noexcept;
 
@@ -168,6 +175,12 @@ public:
     //! @brief Removes elements from end of circular array.
     using view::remove_back;
 
+    //! @brief Inserts element before position in circular array.
+    using view::insert;
+
+    //! @brief Removes elements from circular array.
+    using view::erase;
+
     //! @brief Returns iterator to beginning of circular array.
     using view::begin;
 
@@ -0,0 +1,230 @@
+#ifndef VISTA_CIRCULAR_BITSET_HPP
+#define VISTA_CIRCULAR_BITSET_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <vista/span.hpp>
+#include <vista/detail/config.hpp>
+
+namespace vista
+{
+
+//! @brief Fixed-sized circular buffer of bits.
+//!
+//! A circular double-ended queue of boolean values packed into 64-bit words.
+//! Inserting new values will overwrite old values when the queue is full.
+//!
+//! Size is the current number of bits in the buffer.
+//!
+//! Capacity is the maximum number of bits that can be inserted without
+//! overwriting old bits. Capacity cannot be changed.
+//!
+//! Bits in the underlying words that are not part of the buffer are always
+//! zero, so the number of set bits can be counted a word at a time.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <std::size_t N>
+class circular_bitset
+{
+    static_assert(N > 0, "N must be greater than zero");
+    static_assert(N != dynamic_extent, "N cannot be dynamic_extent");
+
+public:
+    using value_type = bool;
+    using size_type = std::size_t;
+    using word_type = std::uint64_t;
+    using const_segment = span<const word_type>;
+
+    //! @brief Number of bits in each word.
+
+    static constexpr size_type word_bits = 64;
+
+    //! @brief Number of words in the underlying storage.
+
+    static constexpr size_type word_count = (N + word_bits - 1) / word_bits;
+
+    //! @brief Creates empty circular bitset.
+    //!
+    //! @post capacity() == N
+    //! @post size() == 0
+
+    constexpr circular_bitset() noexcept = default;
+
+    //! @brief Checks if circular bitset is empty.
+
+    constexpr bool empty() const noexcept;
+
+    //! @brief Checks if circular bitset is full.
+
+    constexpr bool full() const noexcept;
+
+    //! @brief Returns the maximum possible number of bits in circular bitset.
+
+    constexpr size_type capacity() const noexcept;
+
+    //! @brief Returns the number of bits in circular bitset.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Returns first bit in circular bitset.
+    //!
+    //! @pre !empty()
+
+    constexpr bool front() const noexcept;
+
+    //! @brief Returns last bit in circular bitset.
+    //!
+    //! @pre !empty()
+
+    constexpr bool back() const noexcept;
+
+    //! @brief Returns bit at position.
+    //!
+    //! @pre size() > position
+
+    constexpr bool operator[](size_type position) const noexcept;
+
+    //! @brief Changes bit at position.
+    //!
+    //! @pre size() > position
+
+    VISTA_CXX14_CONSTEXPR
+    void set(size_type position, bool value = true) noexcept;
+
+    //! @brief Clears the circular bitset.
+    //!
+    //! Linear time complexity in the number of words.
+    //!
+    //! @post size() == 0
+
+    VISTA_CXX14_CONSTEXPR
+    void clear() noexcept;
+
+    //! @brief Inserts bit at beginning of circular bitset.
+    //!
+    //! If circular bitset is full, then the bit at the end is silently erased
+    //! to make room for the @c input value.
+
+    VISTA_CXX14_CONSTEXPR
+    void push_front(bool input) noexcept;
+
+    //! @brief Inserts bit at end of circular bitset.
+    //!
+    //! If circular bitset is full, then the bit at the beginning is silently
+    //! erased to make room for the @c input value.
+
+    VISTA_CXX14_CONSTEXPR
+    void push_back(bool input) noexcept;
+
+    //! @brief Inserts multiple bits at end of circular bitset.
+    //!
+    //! The @c count least significant bits of @c input are inserted, starting
+    //! with the least significant bit. The bits are written a word at a time
+    //! rather than a bit at a time.
+    //!
+    //! If circular bitset is full, then bits at the beginning are silently
+    //! erased to make room for the input bits.
+    //!
+    //! @pre count <= word_bits
+    //! @pre count <= capacity()
+
+    VISTA_CXX14_CONSTEXPR
+    void push_back(word_type input, size_type count) noexcept;
+
+    //! @brief Removes and returns bit from beginning of circular bitset.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    bool pop_front() noexcept;
+
+    //! @brief Removes and returns bit from end of circular bitset.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    bool pop_back() noexcept;
+
+    //! @brief Removes bits from beginning of circular bitset.
+    //!
+    //! @pre 0 < count <= size()
+
+    VISTA_CXX14_CONSTEXPR
+    void remove_front(size_type count = 1U) noexcept;
+
+    //! @brief Removes bits from end of circular bitset.
+    //!
+    //! @pre 0 < count <= size()
+
+    VISTA_CXX14_CONSTEXPR
+    void remove_back(size_type count = 1U) noexcept;
+
+    //! @brief Returns the number of set bits in circular bitset.
+    //!
+    //! Linear time complexity in the number of words.
+
+    VISTA_CXX14_CONSTEXPR
+    size_type count() const noexcept;
+
+    //! @brief Returns the number of set bits among the last bits.
+    //!
+    //! Counts the set bits among the @c length most recently inserted bits at
+    //! the end of the circular bitset.
+    //!
+    //! Linear time complexity in the number of words.
+    //!
+    //! @pre length <= size()
+
+    VISTA_CXX14_CONSTEXPR
+    size_type count_back(size_type length) const noexcept;
+
+    //! @brief Returns the underlying words.
+    //!
+    //! The bit at position @c p in the underlying storage is stored in word
+    //! @c p/word_bits at bit @c p%word_bits. The circular bitset may start at
+    //! any position in the underlying storage and wrap around at capacity().
+
+    constexpr const_segment words() const noexcept;
+
+private:
+    constexpr size_type index(size_type) const noexcept;
+    constexpr size_type back_index() const noexcept;
+
+    constexpr bool test_bit(size_type) const noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    void assign_bit(size_type, bool) noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    void assign_range(size_type first, size_type length, word_type input) noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    size_type count_range(size_type first, size_type length) const noexcept;
+
+    static constexpr word_type lower_mask(size_type length) noexcept;
+
+private:
+    struct member
+    {
+        word_type words[word_count] = {};
+        size_type head = 0;
+        size_type size = 0;
+    } member;
+};
+
+} // namespace vista
+
+#include <vista/detail/circular_bitset.ipp>
+
+#endif // VISTA_CIRCULAR_BITSET_HPP
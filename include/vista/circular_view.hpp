@@ -15,13 +15,62 @@
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <vista/functional.hpp> // less
 #include <vista/span.hpp>
+#include <vista/utility.hpp> // pair
 #include <vista/detail/config.hpp>
 #include <vista/detail/type_traits.hpp>
 
 namespace vista
 {
 
+//-----------------------------------------------------------------------------
+// Eviction policies
+//-----------------------------------------------------------------------------
+
+//! @brief Eviction policy that silently overwrites old elements.
+//!
+//! This is the default eviction policy. It has no overhead.
+
+struct overwrite_evictor
+{
+    template <typename U>
+    constexpr bool operator()(const U&) const noexcept
+    {
+        return true;
+    }
+};
+
+//! @brief Eviction policy that rejects insertion into a full view.
+
+struct reject_evictor
+{
+    template <typename U>
+    constexpr bool operator()(const U&) const noexcept
+    {
+        return false;
+    }
+};
+
+//! @brief Eviction policy that counts the overwritten elements.
+
+struct counting_evictor
+{
+    template <typename U>
+    VISTA_CXX14_CONSTEXPR
+    bool operator()(const U&) noexcept
+    {
+        ++count;
+        return true;
+    }
+
+    std::size_t count = 0;
+};
+
+//-----------------------------------------------------------------------------
+// circular_view
+//-----------------------------------------------------------------------------
+
 //! @brief Circular view.
 //!
 //! A view that turns contiguous memory into a circular double-ended queue.
@@ -35,10 +84,19 @@ namespace vista
 //! Capacity is the maximum number of elements that can be inserted without
 //! overwriting old elements. Capacity cannot be changed.
 //!
+//! The Evictor decides what happens when an element is inserted into a full
+//! view. It is invoked as @c evictor(element) with the element that is about
+//! to be overwritten, and returns true if the element may be overwritten, or
+//! false if the insertion must be rejected. The evictor may move the element
+//! elsewhere before it is overwritten. The Evictor must be DefaultConstructible.
+//!
 //! Violation of any precondition results in undefined behavior.
 
-template <typename T, std::size_t Extent = dynamic_extent>
+template <typename T,
+          std::size_t Extent = dynamic_extent,
+          typename Evictor = overwrite_evictor>
 class circular_view
+    : private Evictor
 {
     static_assert(Extent == dynamic_extent || Extent < std::numeric_limits<std::size_t>::max() / 2,
                   "Extent is too large");
@@ -50,9 +108,10 @@ public:
     using pointer = typename std::add_pointer<element_type>::type;
     using reference = typename std::add_lvalue_reference<element_type>::type;
     using const_reference = typename std::add_lvalue_reference<typename std::add_const<element_type>::type>::type;
+    using evictor_type = Evictor;
 
 private:
-    template <typename, std::size_t>
+    template <typename, std::size_t, typename>
     friend class circular_view;
 
     template <typename U>
@@ -127,11 +186,11 @@ private:
         constexpr bool operator>=(const iterator_type&) const noexcept;
 
     private:
-        friend class circular_view<T, Extent>;
+        friend class circular_view<T, Extent, Evictor>;
 
         using view_pointer = typename std::conditional<std::is_const<U>::value,
-                                                       typename std::add_pointer<typename std::add_const<circular_view<T, Extent>>::type>::type,
-                                                       typename std::add_pointer<circular_view<T, Extent>>::type>::type;
+                                                       typename std::add_pointer<typename std::add_const<circular_view<T, Extent, Evictor>>::type>::type,
+                                                       typename std::add_pointer<circular_view<T, Extent, Evictor>>::type>::type;
 
         constexpr basic_iterator(view_pointer parent, const size_type index) noexcept;
 
@@ -180,7 +239,7 @@ public:
     template <typename OtherT,
               std::size_t OtherExtent,
               typename std::enable_if<(Extent == OtherExtent || Extent == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type = 0>
-    explicit constexpr circular_view(const circular_view<OtherT, OtherExtent>& other) noexcept;
+    explicit constexpr circular_view(const circular_view<OtherT, OtherExtent, Evictor>& other) noexcept;
 
     //! @brief Creates circular view by moving.
     //!
@@ -205,7 +264,7 @@ public:
     //! @post size() == input.size()
 
     VISTA_CXX14_CONSTEXPR
-    circular_view& operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+    circular_view& operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
     //! @brief Creates circular view from iterators.
     //!
@@ -262,6 +321,15 @@ public:
 
     constexpr size_type size() const noexcept;
 
+    //! @brief Returns the eviction policy.
+
+    VISTA_CXX14_CONSTEXPR
+    evictor_type& evictor() noexcept;
+
+    //! @brief Returns the eviction policy.
+
+    constexpr const evictor_type& evictor() const noexcept;
+
     //! @brief Returns reference to first element in view.
     //!
     //! @pre !empty()
@@ -312,54 +380,78 @@ public:
 
     //! @brief Replaces circular view with elements from range.
     //!
+    //! Returns the number of inserted elements. Elements that do not fit are
+    //! either overwritten by later elements or rejected, depending on the
+    //! evictor.
+    //!
     //! @post size() == std::min(std::distance(first, last), capacity())
 
     template <typename InputIterator>
     VISTA_CXX14_CONSTEXPR
-    void assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+    size_type assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
     //! @brief Replaces circular view with elements from intializer list.
     //!
+    //! Returns the number of inserted elements.
+    //!
     //! @post size() == std::min(input.size(), capacity())
 
     VISTA_CXX14_CONSTEXPR
-    void assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+    size_type assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
     //! @brief Inserts element at beginning of view.
     //!
-    //! If view is full, then the element at the end of the view is silently erased
-    //! to make room for the @c input value.
+    //! If view is full, then the evictor is invoked with the element at the
+    //! end of the view. If accepted, the element at the end is overwritten to
+    //! make room for the @c input value.
+    //!
+    //! Returns true if the element was inserted, or false if rejected by the
+    //! evictor.
     //!
     //! @pre capacity() > 0
 
     VISTA_CXX14_CONSTEXPR
-    void push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+    bool push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
-    //! @brief Inserts element at beginning of view.
+    //! @brief Inserts elements at beginning of view.
+    //!
+    //! Each element is inserted as with push_front(value_type).
+    //!
+    //! Returns the number of inserted elements, which is less than
+    //! std::distance(first, last) if elements were rejected by the evictor.
     //!
     //! @pre capacity() > 0
 
     template <typename InputIterator>
     VISTA_CXX14_CONSTEXPR
-    void push_front(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+    size_type push_front(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
     //! @brief Inserts element at end of view.
     //!
-    //! If view is full, then the element at the end of the view is silently erased
-    //! to make room for the @c input value.
+    //! If view is full, then the evictor is invoked with the element at the
+    //! beginning of the view. If accepted, the element at the beginning is
+    //! overwritten to make room for the @c input value.
+    //!
+    //! Returns true if the element was inserted, or false if rejected by the
+    //! evictor.
     //!
     //! @pre capacity() > 0
 
     VISTA_CXX14_CONSTEXPR
-    void push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+    bool push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
     //! @brief Inserts elements at end of view.
     //!
+    //! Each element is inserted as with push_back(value_type).
+    //!
+    //! Returns the number of inserted elements, which is less than
+    //! std::distance(first, last) if elements were rejected by the evictor.
+    //!
     //! @pre capacity() > 0
 
     template <typename InputIterator>
     VISTA_CXX14_CONSTEXPR
-    void push_back(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+    size_type push_back(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value && vista::detail::is_nothrow_evictor<Evictor, reference>::value);
 
     //! @brief Removes and returns element from beginning of view.
     //!
@@ -384,7 +476,7 @@ public:
     //! initialized values.
     //!
     //! If the view is full, then the elements at the front are taken from the
-    //! back.
+    //! back. The evictor is not invoked.
     //!
     //! @pre capacity() > 0
     //! @pre count <= capacity()
@@ -424,6 +516,48 @@ public:
     VISTA_CXX14_CONSTEXPR
     void remove_back(size_type count = 1U) noexcept;
 
+    //! @brief Inserts element before position.
+    //!
+    //! Elements on the side of @c position with the fewest elements are moved
+    //! one step to make room for the new element. Elements are moved as
+    //! contiguous segments if value_type is trivially copyable.
+    //!
+    //! Linear time complexity in the distance to the nearest end of the view.
+    //!
+    //! Returns iterator to the inserted element.
+    //!
+    //! @pre !full()
+    //! @pre begin() <= position <= end()
+
+    VISTA_CXX14_CONSTEXPR
+    iterator insert(const_iterator position, value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes element at position.
+    //!
+    //! Elements on the side of @c position with the fewest elements are moved
+    //! one step to close the gap.
+    //!
+    //! Linear time complexity in the distance to the nearest end of the view.
+    //!
+    //! Returns iterator to the element following the removed element.
+    //!
+    //! @pre begin() <= position < end()
+
+    VISTA_CXX14_CONSTEXPR
+    iterator erase(const_iterator position) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes elements in range.
+    //!
+    //! Elements on the side of the range with the fewest elements are moved to
+    //! close the gap.
+    //!
+    //! Returns iterator to the element following the removed elements.
+    //!
+    //! @pre begin() <= first <= last <= end()
+
+    VISTA_CXX14_CONSTEXPR
+    iterator erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
     //! @brief Rotates elements so view starts at beginning of storage.
     //!
     //! For instance, a view consisting of the sequence A, B, C, may be stored
@@ -598,6 +732,12 @@ private:
     VISTA_CXX14_CONSTEXPR
     void swap_range(size_type lhs, size_type rhs, size_type length) noexcept(vista::detail::is_nothrow_swappable<value_type>::value);
 
+    VISTA_CXX14_CONSTEXPR
+    void move_range(size_type from, size_type to, size_type length) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+    VISTA_CXX14_CONSTEXPR
+    void move_range(size_type from, size_type to, size_type length, bool backward, std::false_type) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+    void move_range(size_type from, size_type to, size_type length, bool backward, std::true_type) noexcept;
+
 private:
     template <typename T1, std::size_t E1>
     struct member_storage
@@ -615,7 +755,7 @@ private:
         constexpr member_storage(const member_storage&, pointer data) noexcept;
 
         template <typename OtherT, std::size_t OtherExtent>
-        explicit constexpr member_storage(const circular_view<OtherT, OtherExtent>&) noexcept;
+        explicit constexpr member_storage(const circular_view<OtherT, OtherExtent, Evictor>&) noexcept;
 
         template <typename ContiguousIterator>
         VISTA_CXX14_CONSTEXPR
@@ -659,7 +799,7 @@ private:
         constexpr member_storage(const member_storage&, pointer data) noexcept;
 
         template <typename OtherT, std::size_t OtherExtent>
-        explicit constexpr member_storage(const circular_view<OtherT, OtherExtent>&) noexcept;
+        explicit constexpr member_storage(const circular_view<OtherT, OtherExtent, Evictor>&) noexcept;
 
         template <typename ContiguousIterator>
         constexpr member_storage(ContiguousIterator, ContiguousIterator) noexcept;
@@ -689,6 +829,152 @@ private:
     struct member_storage<T, Extent> member;
 };
 
+//-----------------------------------------------------------------------------
+// Sorted algorithms
+//-----------------------------------------------------------------------------
+
+//! @brief Returns position where element is or would have been.
+//!
+//! Optimized version for sorted circular view. The segment that contains the
+//! position is selected with a single comparison, and then the segment is
+//! searched as a contiguous range.
+//!
+//! Logarithmic time complexity.
+//!
+//! @pre is_sorted(view.begin(), view.end())
+
+template <typename T, std::size_t Extent, typename Evictor, typename U>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::iterator
+lower_bound_sorted(circular_view<T, Extent, Evictor>& view,
+                   const U& needle) noexcept;
+
+template <typename T, std::size_t Extent, typename Evictor, typename U>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::const_iterator
+lower_bound_sorted(const circular_view<T, Extent, Evictor>& view,
+                   const U& needle) noexcept;
+
+//! @brief Returns position where element is or would have been.
+//!
+//! @pre is_sorted(view.begin(), view.end(), compare)
+
+template <typename T, std::size_t Extent, typename Evictor, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::iterator
+lower_bound_sorted(circular_view<T, Extent, Evictor>& view,
+                   const U& needle,
+                   Compare compare) noexcept;
+
+template <typename T, std::size_t Extent, typename Evictor, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::const_iterator
+lower_bound_sorted(const circular_view<T, Extent, Evictor>& view,
+                   const U& needle,
+                   Compare compare) noexcept;
+
+//! @brief Returns position after where element is or would have been.
+//!
+//! Optimized version for sorted circular view.
+//!
+//! Logarithmic time complexity.
+//!
+//! @pre is_sorted(view.begin(), view.end())
+
+template <typename T, std::size_t Extent, typename Evictor, typename U>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::iterator
+upper_bound_sorted(circular_view<T, Extent, Evictor>& view,
+                   const U& needle) noexcept;
+
+template <typename T, std::size_t Extent, typename Evictor, typename U>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::const_iterator
+upper_bound_sorted(const circular_view<T, Extent, Evictor>& view,
+                   const U& needle) noexcept;
+
+//! @brief Returns position after where element is or would have been.
+//!
+//! @pre is_sorted(view.begin(), view.end(), compare)
+
+template <typename T, std::size_t Extent, typename Evictor, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::iterator
+upper_bound_sorted(circular_view<T, Extent, Evictor>& view,
+                   const U& needle,
+                   Compare compare) noexcept;
+
+template <typename T, std::size_t Extent, typename Evictor, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::const_iterator
+upper_bound_sorted(const circular_view<T, Extent, Evictor>& view,
+                   const U& needle,
+                   Compare compare) noexcept;
+
+//! @brief Returns range of elements equivalent to needle.
+//!
+//! Optimized version for sorted circular view.
+//!
+//! Logarithmic time complexity.
+//!
+//! @pre is_sorted(view.begin(), view.end())
+
+template <typename T, std::size_t Extent, typename Evictor, typename U>
+VISTA_CXX14_CONSTEXPR
+pair<typename circular_view<T, Extent, Evictor>::iterator,
+     typename circular_view<T, Extent, Evictor>::iterator>
+equal_range_sorted(circular_view<T, Extent, Evictor>& view,
+                   const U& needle) noexcept;
+
+template <typename T, std::size_t Extent, typename Evictor, typename U>
+VISTA_CXX14_CONSTEXPR
+pair<typename circular_view<T, Extent, Evictor>::const_iterator,
+     typename circular_view<T, Extent, Evictor>::const_iterator>
+equal_range_sorted(const circular_view<T, Extent, Evictor>& view,
+                   const U& needle) noexcept;
+
+//! @brief Returns range of elements equivalent to needle.
+//!
+//! @pre is_sorted(view.begin(), view.end(), compare)
+
+template <typename T, std::size_t Extent, typename Evictor, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+pair<typename circular_view<T, Extent, Evictor>::iterator,
+     typename circular_view<T, Extent, Evictor>::iterator>
+equal_range_sorted(circular_view<T, Extent, Evictor>& view,
+                   const U& needle,
+                   Compare compare) noexcept;
+
+template <typename T, std::size_t Extent, typename Evictor, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+pair<typename circular_view<T, Extent, Evictor>::const_iterator,
+     typename circular_view<T, Extent, Evictor>::const_iterator>
+equal_range_sorted(const circular_view<T, Extent, Evictor>& view,
+                   const U& needle,
+                   Compare compare) noexcept;
+
+//-----------------------------------------------------------------------------
+// Erasure
+//-----------------------------------------------------------------------------
+
+//! @brief Removes all elements that satisfy predicate.
+//!
+//! The remaining elements are compacted towards the front of the view in a
+//! single pass across the segments. The relative order of the remaining
+//! elements is preserved. The removed elements linger in a moved-from state in
+//! the underlying storage.
+//!
+//! Linear time complexity. One move assignment per remaining element after the
+//! first removed element.
+//!
+//! Returns the number of removed elements.
+
+template <typename T, std::size_t Extent, typename Evictor, typename Predicate>
+VISTA_CXX14_CONSTEXPR
+typename circular_view<T, Extent, Evictor>::size_type
+erase_if(circular_view<T, Extent, Evictor>& view,
+         Predicate predicate) noexcept(std::is_nothrow_move_assignable<T>::value);
+
 } // namespace vista
 
 #include <vista/detail/circular_view.ipp>
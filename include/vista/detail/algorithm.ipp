@@ -44,6 +44,39 @@ OutputIterator copy(InputIterator first,
 // Heap algorithms
 //-----------------------------------------------------------------------------
 
+namespace detail
+{
+
+// Moves element at position down until no child is greater
+
+template <bool WithConstexpr,
+          std::size_t Arity,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void sift_down_heap(RandomAccessIterator first,
+                    std::size_t size,
+                    std::size_t position,
+                    Compare& comp)
+{
+    while (Arity * position + 1 < size)
+    {
+        const auto child = Arity * position + 1;
+        const auto end = (child + Arity < size) ? child + Arity : size;
+        auto selected = position;
+        for (auto current = child; current < end; ++current)
+        {
+            selected = comp(first[selected], first[current]) ? current : selected;
+        }
+        if (selected == position)
+            break;
+        vista::swap<WithConstexpr>(first[position], first[selected]);
+        position = selected;
+    }
+}
+
+} // namespace detail
+
 template <typename RandomAccessIterator>
 VISTA_CXX14_CONSTEXPR
 void push_heap(RandomAccessIterator first,
@@ -65,19 +98,27 @@ inline void push_heap(RandomAccessIterator first,
 }
 
 template <bool WithConstexpr,
+          std::size_t Arity,
           typename RandomAccessIterator,
           typename Compare>
 VISTA_CXX14_CONSTEXPR
 inline void push_heap(RandomAccessIterator first,
                       RandomAccessIterator last, Compare comp)
 {
-    auto position = last - first;
-    auto parent = position >> 1;
-    while (parent > 0 && comp(first[parent - 1], first[position - 1]))
+    static_assert(Arity >= 2, "Arity must be at least two");
+
+    // Unsigned arithmetic turns division by power-of-two arity into shifts
+    std::size_t position = last - first;
+    if (position == 0)
+        return;
+    --position;
+    while (position > 0)
     {
-        vista::swap<WithConstexpr>(first[parent - 1], first[position - 1]);
+        const auto parent = (position - 1) / Arity;
+        if (!comp(first[parent], first[position]))
+            break;
+        vista::swap<WithConstexpr>(first[parent], first[position]);
         position = parent;
-        parent = position >> 1;
     }
 }
 
@@ -101,6 +142,7 @@ void pop_heap(RandomAccessIterator first,
 }
 
 template <bool WithConstexpr,
+          std::size_t Arity,
           typename RandomAccessIterator,
           typename Compare>
 VISTA_CXX14_CONSTEXPR
@@ -108,21 +150,159 @@ void pop_heap(RandomAccessIterator first,
               RandomAccessIterator last,
               Compare comp)
 {
+    static_assert(Arity >= 2, "Arity must be at least two");
+
     --last;
     vista::swap<WithConstexpr>(*first, *last);
 
-    auto size = last - first;
-    auto position = 0;
-    while (2 * position + 1 < size)
+    detail::sift_down_heap<WithConstexpr, Arity>(first, std::size_t(last - first), 0, comp);
+}
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+void make_heap(RandomAccessIterator first,
+               RandomAccessIterator last)
+{
+    vista::make_heap<false>(std::move(first),
+                            std::move(last),
+                            vista::less<decltype(*first)>{});
+}
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void make_heap(RandomAccessIterator first,
+               RandomAccessIterator last,
+               Compare comp)
+{
+    vista::make_heap<false>(std::move(first), std::move(last), std::move(comp));
+}
+
+template <bool WithConstexpr,
+          std::size_t Arity,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void make_heap(RandomAccessIterator first,
+               RandomAccessIterator last,
+               Compare comp)
+{
+    static_assert(Arity >= 2, "Arity must be at least two");
+
+    const std::size_t size = last - first;
+    if (size < 2)
+        return;
+
+    // Leaves are already heaps
+    std::size_t position = (size - 2) / Arity + 1;
+    while (position > 0)
     {
-        const auto left = 2 * position + 1;
-        const auto right = left + 1;
-        auto selected = comp(first[position], first[left]) ? left : position;
-        selected = (right < size && comp(first[selected], first[right])) ? right : selected;
-        if (selected == position)
-            break;
-        vista::swap<WithConstexpr>(first[position], first[selected]);
-        position = selected;
+        --position;
+        detail::sift_down_heap<WithConstexpr, Arity>(first, size, position, comp);
+    }
+}
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator is_heap_until(RandomAccessIterator first,
+                                   RandomAccessIterator last)
+{
+    return vista::is_heap_until<2>(std::move(first),
+                                   std::move(last),
+                                   vista::less<decltype(*first)>{});
+}
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator is_heap_until(RandomAccessIterator first,
+                                   RandomAccessIterator last,
+                                   Compare comp)
+{
+    return vista::is_heap_until<2>(std::move(first), std::move(last), std::move(comp));
+}
+
+template <std::size_t Arity,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator is_heap_until(RandomAccessIterator first,
+                                   RandomAccessIterator last,
+                                   Compare comp)
+{
+    static_assert(Arity >= 2, "Arity must be at least two");
+
+    const std::size_t size = last - first;
+    for (std::size_t position = 1; position < size; ++position)
+    {
+        if (comp(first[(position - 1) / Arity], first[position]))
+            return first + position;
+    }
+    return last;
+}
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+bool is_heap(RandomAccessIterator first,
+             RandomAccessIterator last)
+{
+    return vista::is_heap_until(first, last) == last;
+}
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+bool is_heap(RandomAccessIterator first,
+             RandomAccessIterator last,
+             Compare comp)
+{
+    return vista::is_heap_until(first, last, std::move(comp)) == last;
+}
+
+template <std::size_t Arity,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+bool is_heap(RandomAccessIterator first,
+             RandomAccessIterator last,
+             Compare comp)
+{
+    return vista::is_heap_until<Arity>(first, last, std::move(comp)) == last;
+}
+
+template <typename RandomAccessIterator>
+VISTA_CXX14_CONSTEXPR
+void sort_heap(RandomAccessIterator first,
+               RandomAccessIterator last)
+{
+    vista::sort_heap<false>(std::move(first),
+                            std::move(last),
+                            vista::less<decltype(*first)>{});
+}
+
+template <typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void sort_heap(RandomAccessIterator first,
+               RandomAccessIterator last,
+               Compare comp)
+{
+    vista::sort_heap<false>(std::move(first), std::move(last), std::move(comp));
+}
+
+template <bool WithConstexpr,
+          std::size_t Arity,
+          typename RandomAccessIterator,
+          typename Compare>
+VISTA_CXX14_CONSTEXPR
+void sort_heap(RandomAccessIterator first,
+               RandomAccessIterator last,
+               Compare comp)
+{
+    while (last - first > 1)
+    {
+        vista::pop_heap<WithConstexpr, Arity>(first, last, comp);
+        --last;
     }
 }
 
@@ -164,6 +344,40 @@ RandomAccessIterator lower_bound_sorted(RandomAccessIterator first,
     return first + compare(*first, needle);
 }
 
+template <typename RandomAccessIterator, typename T>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator upper_bound_sorted(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T& needle) noexcept
+{
+    return upper_bound_sorted(std::move(first),
+                              std::move(last),
+                              needle,
+                              vista::less<T>{});
+}
+
+template <typename RandomAccessIterator, typename T, typename Compare>
+VISTA_CXX14_CONSTEXPR
+RandomAccessIterator upper_bound_sorted(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T& needle,
+                                        Compare compare) noexcept
+{
+    if (first == last)
+        return last;
+
+    // Branchless binary search
+    auto step = last - first;
+    do
+    {
+        const auto half = step >> 1;
+        first += compare(needle, first[half]) ? 0 : half;
+        step -= half;
+    } while (step > 1);
+
+    return first + !compare(needle, *first);
+}
+
 template <typename RandomAccessIterator>
 VISTA_CXX14_CONSTEXPR
 RandomAccessIterator push_sorted(RandomAccessIterator first,
@@ -0,0 +1,83 @@
+#ifndef VISTA_DETAIL_BIT_HPP
+#define VISTA_DETAIL_BIT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vista/detail/config.hpp>
+
+namespace vista
+{
+namespace detail
+{
+
+// std::popcount is not available before C++20
+
+#if defined(__GNUC__) || defined(__clang__)
+
+constexpr int popcount(std::uint64_t value) noexcept
+{
+    return __builtin_popcountll(value);
+}
+
+#else
+
+VISTA_CXX14_CONSTEXPR
+inline int popcount(std::uint64_t value) noexcept
+{
+    // SWAR population count
+    value = value - ((value >> 1) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return int((value * 0x0101010101010101ULL) >> 56);
+}
+
+#endif
+
+// std::countl_zero and std::countr_zero are not available before C++20
+
+#if defined(__GNUC__) || defined(__clang__)
+
+constexpr int countl_zero(std::uint64_t value) noexcept
+{
+    return (value == 0) ? 64 : __builtin_clzll(value);
+}
+
+constexpr int countr_zero(std::uint64_t value) noexcept
+{
+    return (value == 0) ? 64 : __builtin_ctzll(value);
+}
+
+#else
+
+VISTA_CXX14_CONSTEXPR
+inline int countl_zero(std::uint64_t value) noexcept
+{
+    int result = 0;
+    for (std::uint64_t mask = std::uint64_t(1) << 63; mask != 0 && (value & mask) == 0; mask >>= 1)
+    {
+        ++result;
+    }
+    return result;
+}
+
+VISTA_CXX14_CONSTEXPR
+inline int countr_zero(std::uint64_t value) noexcept
+{
+    return (value == 0) ? 64 : popcount((value & (~value + 1)) - 1);
+}
+
+#endif
+
+} // namespace detail
+} // namespace vista
+
+#endif // VISTA_DETAIL_BIT_HPP
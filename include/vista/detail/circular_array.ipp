@@ -11,15 +11,15 @@
 namespace vista
 {
 
-template <typename T, std::size_t N>
-constexpr circular_array<T, N>::circular_array() noexcept
+template <typename T, std::size_t N, typename EV>
+constexpr circular_array<T, N, EV>::circular_array() noexcept
     : view(storage::begin(), storage::end())
 {
 }
 
 // Custom copy constructor is needed to set view pointer correctly.
-template <typename T, std::size_t N>
-constexpr circular_array<T, N>::circular_array(const circular_array& other) noexcept(std::is_nothrow_copy_constructible<value_type>::value)
+template <typename T, std::size_t N, typename EV>
+constexpr circular_array<T, N, EV>::circular_array(const circular_array& other) noexcept(std::is_nothrow_copy_constructible<value_type>::value)
     : storage(static_cast<const storage&>(other)),
       view(static_cast<const view&>(other), &*storage::begin())
 {
@@ -27,9 +27,9 @@ constexpr circular_array<T, N>::circular_array(const circular_array& other) noex
 }
 
 // Custom copy assignment is needed to set view pointer correctly.
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_array<T, N>::operator=(const circular_array& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> circular_array&
+auto circular_array<T, N, EV>::operator=(const circular_array& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> circular_array&
 {
     static_assert(std::is_copy_assignable<T>::value, "Copy assignment only usable when T is copy assignable");
 
@@ -39,24 +39,24 @@ auto circular_array<T, N>::operator=(const circular_array& other) noexcept(std::
 }
 
 // Emulates aggregate construction
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename EV>
 template <typename... Args>
-constexpr circular_array<T, N>::circular_array(value_type arg1, Args&&... args) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+constexpr circular_array<T, N, EV>::circular_array(value_type arg1, Args&&... args) noexcept(std::is_nothrow_move_assignable<value_type>::value)
     : storage{ std::move(arg1), std::forward<decltype(args)>(args)... },
       view(storage::begin(), storage::end(), storage::begin(), 1 + sizeof...(args))
 {
 }
 
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_array<T, N>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> circular_array&
+auto circular_array<T, N, EV>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value) -> circular_array&
 {
     view::operator=(std::move(input));
     return *this;
 }
 
-template <typename T, std::size_t N>
-constexpr auto circular_array<T, N>::max_size() const noexcept -> size_type
+template <typename T, std::size_t N, typename EV>
+constexpr auto circular_array<T, N, EV>::max_size() const noexcept -> size_type
 {
     return capacity();
 }
@@ -0,0 +1,299 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <vista/detail/bit.hpp>
+
+namespace vista
+{
+
+template <std::size_t N>
+constexpr std::size_t circular_bitset<N>::word_bits;
+
+template <std::size_t N>
+constexpr std::size_t circular_bitset<N>::word_count;
+
+template <std::size_t N>
+constexpr bool circular_bitset<N>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <std::size_t N>
+constexpr bool circular_bitset<N>::full() const noexcept
+{
+    return size() == capacity();
+}
+
+template <std::size_t N>
+constexpr auto circular_bitset<N>::capacity() const noexcept -> size_type
+{
+    return N;
+}
+
+template <std::size_t N>
+constexpr auto circular_bitset<N>::size() const noexcept -> size_type
+{
+    return member.size;
+}
+
+template <std::size_t N>
+constexpr bool circular_bitset<N>::front() const noexcept
+{
+    VISTA_CXX14(assert(!empty()));
+
+    return test_bit(member.head);
+}
+
+template <std::size_t N>
+constexpr bool circular_bitset<N>::back() const noexcept
+{
+    VISTA_CXX14(assert(!empty()));
+
+    return test_bit(back_index());
+}
+
+template <std::size_t N>
+constexpr bool circular_bitset<N>::operator[](size_type position) const noexcept
+{
+    return test_bit(index(member.head + position));
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::set(size_type position, bool value) noexcept
+{
+    assert(position < size());
+
+    assign_bit(index(member.head + position), value);
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::clear() noexcept
+{
+    for (auto& word : member.words)
+    {
+        word = 0;
+    }
+    member.head = 0;
+    member.size = 0;
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::push_front(bool input) noexcept
+{
+    member.head = index(member.head + capacity() - 1);
+    assign_bit(member.head, input);
+    if (!full())
+    {
+        ++member.size;
+    }
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::push_back(bool input) noexcept
+{
+    if (full())
+    {
+        // Overwrite the front bit
+        assign_bit(member.head, input);
+        member.head = index(member.head + 1);
+    }
+    else
+    {
+        assign_bit(index(member.head + member.size), input);
+        ++member.size;
+    }
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::push_back(word_type input, size_type count) noexcept
+{
+    assert(count <= word_bits);
+    assert(count <= capacity());
+
+    assign_range(index(member.head + member.size), count, input);
+
+    const auto unused = capacity() - size();
+    if (count > unused)
+    {
+        member.head = index(member.head + count - unused);
+        member.size = capacity();
+    }
+    else
+    {
+        member.size += count;
+    }
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+bool circular_bitset<N>::pop_front() noexcept
+{
+    assert(!empty());
+
+    const bool result = front();
+    remove_front();
+    return result;
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+bool circular_bitset<N>::pop_back() noexcept
+{
+    assert(!empty());
+
+    const bool result = back();
+    remove_back();
+    return result;
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::remove_front(size_type count) noexcept
+{
+    assert(size() > 0);
+    assert(count <= size());
+
+    // Removed bits are zeroed to keep the counting invariant
+    assign_range(member.head, count, 0);
+    member.head = index(member.head + count);
+    member.size -= count;
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::remove_back(size_type count) noexcept
+{
+    assert(size() > 0);
+    assert(count <= size());
+
+    // Removed bits are zeroed to keep the counting invariant
+    assign_range(index(member.head + member.size - count), count, 0);
+    member.size -= count;
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+auto circular_bitset<N>::count() const noexcept -> size_type
+{
+    // Unused bits are always zero
+    size_type result = 0;
+    for (const auto& word : member.words)
+    {
+        result += detail::popcount(word);
+    }
+    return result;
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+auto circular_bitset<N>::count_back(size_type length) const noexcept -> size_type
+{
+    assert(length <= size());
+
+    return count_range(index(member.head + member.size - length), length);
+}
+
+template <std::size_t N>
+constexpr auto circular_bitset<N>::words() const noexcept -> const_segment
+{
+    return const_segment(member.words, word_count);
+}
+
+//-----------------------------------------------------------------------------
+
+template <std::size_t N>
+constexpr auto circular_bitset<N>::index(size_type position) const noexcept -> size_type
+{
+    // Position is always less than twice the capacity
+    return (position >= capacity()) ? position - capacity() : position;
+}
+
+template <std::size_t N>
+constexpr auto circular_bitset<N>::back_index() const noexcept -> size_type
+{
+    return index(member.head + member.size - 1);
+}
+
+template <std::size_t N>
+constexpr bool circular_bitset<N>::test_bit(size_type position) const noexcept
+{
+    return (member.words[position / word_bits] >> (position % word_bits)) & 1U;
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::assign_bit(size_type position, bool value) noexcept
+{
+    const auto offset = position % word_bits;
+    auto& word = member.words[position / word_bits];
+    word = (word & ~(word_type(1) << offset)) | (word_type(value) << offset);
+}
+
+// Assigns the least significant bits of input to a range of bits that may
+// wrap around. Input is zero-extended if length exceeds word_bits.
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+void circular_bitset<N>::assign_range(size_type position,
+                                      size_type length,
+                                      word_type input) noexcept
+{
+    while (length > 0)
+    {
+        const auto offset = position % word_bits;
+        auto chunk = word_bits - offset;
+        chunk = (chunk < capacity() - position) ? chunk : capacity() - position;
+        chunk = (chunk < length) ? chunk : length;
+
+        const auto mask = lower_mask(chunk);
+        auto& word = member.words[position / word_bits];
+        word = (word & ~(mask << offset)) | ((input & mask) << offset);
+
+        input = (chunk < word_bits) ? (input >> chunk) : 0;
+        position = index(position + chunk);
+        length -= chunk;
+    }
+}
+
+template <std::size_t N>
+VISTA_CXX14_CONSTEXPR
+auto circular_bitset<N>::count_range(size_type position,
+                                     size_type length) const noexcept -> size_type
+{
+    size_type result = 0;
+    while (length > 0)
+    {
+        const auto offset = position % word_bits;
+        auto chunk = word_bits - offset;
+        chunk = (chunk < capacity() - position) ? chunk : capacity() - position;
+        chunk = (chunk < length) ? chunk : length;
+
+        result += detail::popcount(member.words[position / word_bits] & (lower_mask(chunk) << offset));
+
+        position = index(position + chunk);
+        length -= chunk;
+    }
+    return result;
+}
+
+template <std::size_t N>
+constexpr auto circular_bitset<N>::lower_mask(size_type length) noexcept -> word_type
+{
+    return (length < word_bits)
+        ? (word_type(1) << length) - 1
+        : ~word_type(0);
+}
+
+} // namespace vista
@@ -8,7 +8,10 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <vista/algorithm.hpp>
 
 namespace vista
 {
@@ -17,62 +20,69 @@ namespace vista
 // circular_view<T>
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
-constexpr circular_view<T, E>::circular_view() noexcept
+template <typename T, std::size_t E, typename EV>
+constexpr circular_view<T, E, EV>::circular_view() noexcept
+    : EV()
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename OtherT,
           std::size_t OtherExtent,
           typename std::enable_if<(E == OtherExtent || E == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type>
-constexpr circular_view<T, E>::circular_view(const circular_view<OtherT, OtherExtent>& other) noexcept
-    : member(other)
+constexpr circular_view<T, E, EV>::circular_view(const circular_view<OtherT, OtherExtent, EV>& other) noexcept
+    : EV(other.evictor()),
+      member(other)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename ContiguousIterator>
-constexpr circular_view<T, E>::circular_view(ContiguousIterator begin,
-                                             ContiguousIterator end) noexcept
-    : member(std::move(begin), std::move(end))
+constexpr circular_view<T, E, EV>::circular_view(ContiguousIterator begin,
+                                                 ContiguousIterator end) noexcept
+    : EV(),
+      member(std::move(begin), std::move(end))
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename ContiguousIterator>
-constexpr circular_view<T, E>::circular_view(ContiguousIterator begin,
-                                             ContiguousIterator end,
-                                             ContiguousIterator first,
-                                             size_type length) noexcept
-    : member(std::move(begin), std::move(end), std::move(first), length)
+constexpr circular_view<T, E, EV>::circular_view(ContiguousIterator begin,
+                                                 ContiguousIterator end,
+                                                 ContiguousIterator first,
+                                                 size_type length) noexcept
+    : EV(),
+      member(std::move(begin), std::move(end), std::move(first), length)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <std::size_t N,
           typename std::enable_if<(E == N || E == dynamic_extent), int>::type>
-constexpr circular_view<T, E>::circular_view(value_type (&array)[N]) noexcept
-    : member(array)
+constexpr circular_view<T, E, EV>::circular_view(value_type (&array)[N]) noexcept
+    : EV(),
+      member(array)
 {
 }
 
-template <typename T, std::size_t E>
-constexpr circular_view<T, E>::circular_view(const circular_view& other, pointer data) noexcept
-    : member(other.member, data)
+template <typename T, std::size_t E, typename EV>
+constexpr circular_view<T, E, EV>::circular_view(const circular_view& other, pointer data) noexcept
+    : EV(other.evictor()),
+      member(other.member, data)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::assign(const circular_view& other, pointer data) noexcept
+void circular_view<T, E, EV>::assign(const circular_view& other, pointer data) noexcept
 {
+    evictor() = other.evictor();
     member.assign(other.member, data);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> circular_view&
+auto circular_view<T, E, EV>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value) -> circular_view&
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
@@ -80,160 +90,187 @@ auto circular_view<T, E>::operator=(std::initializer_list<value_type> input) noe
     return *this;
 }
 
-template <typename T, std::size_t E>
-constexpr bool circular_view<T, E>::empty() const noexcept
+template <typename T, std::size_t E, typename EV>
+constexpr bool circular_view<T, E, EV>::empty() const noexcept
 {
     return size() == 0;
 }
 
-template <typename T, std::size_t E>
-constexpr bool circular_view<T, E>::full() const noexcept
+template <typename T, std::size_t E, typename EV>
+constexpr bool circular_view<T, E, EV>::full() const noexcept
 {
     return size() == capacity();
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::capacity() const noexcept -> size_type
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::capacity() const noexcept -> size_type
 {
     return member.capacity();
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::size() const noexcept -> size_type
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::size() const noexcept -> size_type
 {
     return member.size;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::front() noexcept -> reference
+auto circular_view<T, E, EV>::evictor() noexcept -> evictor_type&
+{
+    return *this;
+}
+
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::evictor() const noexcept -> const evictor_type&
+{
+    return *this;
+}
+
+template <typename T, std::size_t E, typename EV>
+VISTA_CXX14_CONSTEXPR
+auto circular_view<T, E, EV>::front() noexcept -> reference
 {
     assert(!empty());
 
     return at(front_index());
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::front() const noexcept -> const_reference
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::front() const noexcept -> const_reference
 {
     VISTA_CXX14(assert(!empty()));
 
     return at(front_index());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::back() noexcept -> reference
+auto circular_view<T, E, EV>::back() noexcept -> reference
 {
     assert(!empty());
 
     return at(back_index());
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::back() const noexcept -> const_reference
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::back() const noexcept -> const_reference
 {
     VISTA_CXX14(assert(!empty()));
 
     return at(back_index());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::operator[](size_type position) noexcept -> reference
+auto circular_view<T, E, EV>::operator[](size_type position) noexcept -> reference
 {
     return at(front_index() + position);
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::operator[](size_type position) const noexcept -> const_reference
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::operator[](size_type position) const noexcept -> const_reference
 {
     return at(front_index() + position);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::clear() noexcept
+void circular_view<T, E, EV>::clear() noexcept
 {
     member.size = 0;
     member.next = member.capacity();
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename InputIterator>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+auto circular_view<T, E, EV>::assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value) -> size_type
 {
     clear();
-    push_back(std::move(first), std::move(last));
+    return push_back(std::move(first), std::move(last));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+auto circular_view<T, E, EV>::assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value) -> size_type
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
     clear();
+    size_type result = 0;
     for (auto&& value : input)
     {
-        push_back(std::move(value));
+        result += push_back(std::move(value)) ? 1 : 0;
     }
+    return result;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+bool circular_view<T, E, EV>::push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value)
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
+    if (full() && !evictor()(back()))
+        return false;
+
     expand_front();
     front() = std::move(input);
+    return true;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename InputIterator>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::push_front(InputIterator first,
-                                     InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+auto circular_view<T, E, EV>::push_front(InputIterator first,
+                                         InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value) -> size_type
 {
     static_assert(std::is_copy_assignable<T>::value, "T must be CopyAssignable");
 
+    size_type result = 0;
     while (first != last)
     {
-        push_front(*first);
+        result += push_front(*first) ? 1 : 0;
         ++first;
     }
+    return result;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+bool circular_view<T, E, EV>::push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value)
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
+    if (full() && !evictor()(front()))
+        return false;
+
     expand_back();
     back() = std::move(input);
+    return true;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename InputIterator>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::push_back(InputIterator first,
-                                    InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+auto circular_view<T, E, EV>::push_back(InputIterator first,
+                                        InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value && vista::detail::is_nothrow_evictor<EV, reference>::value) -> size_type
 {
     static_assert(std::is_copy_assignable<T>::value, "T must be CopyAssignable");
 
+    size_type result = 0;
     while (first != last)
     {
-        push_back(*first);
+        result += push_back(*first) ? 1 : 0;
         ++first;
     }
+    return result;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::pop_front() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
+auto circular_view<T, E, EV>::pop_front() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
 {
     static_assert(std::is_move_constructible<T>::value, "T must be MoveConstructible");
 
@@ -242,9 +279,9 @@ auto circular_view<T, E>::pop_front() noexcept(std::is_nothrow_move_constructibl
     return std::move(old_front);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::pop_back() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
+auto circular_view<T, E, EV>::pop_back() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
 {
     static_assert(std::is_move_constructible<T>::value, "T must be MoveConstructible");
 
@@ -253,9 +290,9 @@ auto circular_view<T, E>::pop_back() noexcept(std::is_nothrow_move_constructible
     return std::move(old_back);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::expand_front(size_type count) noexcept
+void circular_view<T, E, EV>::expand_front(size_type count) noexcept
 {
     assert(count <= capacity());
 
@@ -271,9 +308,9 @@ void circular_view<T, E>::expand_front(size_type count) noexcept
     }
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::expand_back(size_type count) noexcept
+void circular_view<T, E, EV>::expand_back(size_type count) noexcept
 {
     assert(count <= capacity());
 
@@ -288,9 +325,9 @@ void circular_view<T, E>::expand_back(size_type count) noexcept
     }
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::remove_front(size_type count) noexcept
+void circular_view<T, E, EV>::remove_front(size_type count) noexcept
 {
     assert(size() > 0);
     assert(count <= size());
@@ -298,9 +335,9 @@ void circular_view<T, E>::remove_front(size_type count) noexcept
     member.size -= count;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::remove_back(size_type count) noexcept
+void circular_view<T, E, EV>::remove_back(size_type count) noexcept
 {
     assert(size() > 0);
     assert(count <= size());
@@ -309,9 +346,73 @@ void circular_view<T, E>::remove_back(size_type count) noexcept
     member.size -= count;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::rotate_front() noexcept(vista::detail::is_nothrow_swappable<value_type>::value)
+auto circular_view<T, E, EV>::insert(const_iterator position,
+                                     value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> iterator
+{
+    static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
+    assert(!full());
+
+    const auto offset = size_type(position - cbegin());
+    assert(offset <= size());
+
+    if (offset < size() - offset)
+    {
+        // Move leading elements towards the front
+        expand_front();
+        move_range(front_index() + 1, front_index(), offset);
+    }
+    else
+    {
+        // Move trailing elements towards the back
+        expand_back();
+        move_range(front_index() + offset, front_index() + offset + 1, size() - offset - 1);
+    }
+    at(front_index() + offset) = std::move(input);
+    return begin() + offset;
+}
+
+template <typename T, std::size_t E, typename EV>
+VISTA_CXX14_CONSTEXPR
+auto circular_view<T, E, EV>::erase(const_iterator position) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> iterator
+{
+    return erase(position, position + 1);
+}
+
+template <typename T, std::size_t E, typename EV>
+VISTA_CXX14_CONSTEXPR
+auto circular_view<T, E, EV>::erase(const_iterator first,
+                                    const_iterator last) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> iterator
+{
+    static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
+
+    const auto offset = size_type(first - cbegin());
+    const auto count = size_type(last - first);
+    assert(offset + count <= size());
+
+    if (count == 0)
+        return begin() + offset;
+
+    const auto trailing = size() - offset - count;
+    if (offset < trailing)
+    {
+        // Move leading elements towards the back
+        move_range(front_index(), front_index() + count, offset);
+        remove_front(count);
+    }
+    else
+    {
+        // Move trailing elements towards the front
+        move_range(front_index() + offset + count, front_index() + offset, trailing);
+        remove_back(count);
+    }
+    return begin() + offset;
+}
+
+template <typename T, std::size_t E, typename EV>
+VISTA_CXX14_CONSTEXPR
+void circular_view<T, E, EV>::rotate_front() noexcept(vista::detail::is_nothrow_swappable<value_type>::value)
 {
     if (empty())
         return;
@@ -325,85 +426,85 @@ void circular_view<T, E>::rotate_front() noexcept(vista::detail::is_nothrow_swap
     member.next = member.capacity() + size();
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::begin() noexcept -> iterator
+auto circular_view<T, E, EV>::begin() noexcept -> iterator
 {
     return iterator(this, vindex(front_index()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::begin() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::begin() const noexcept -> const_iterator
 {
     return const_iterator(this, vindex(front_index()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::cbegin() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::cbegin() const noexcept -> const_iterator
 {
     return const_iterator(this, vindex(front_index()));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::end() noexcept -> iterator
+auto circular_view<T, E, EV>::end() noexcept -> iterator
 {
     return iterator(this, vindex(member.next));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::end() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::end() const noexcept -> const_iterator
 {
     return const_iterator(this, vindex(member.next));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::cend() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::cend() const noexcept -> const_iterator
 {
     return const_iterator(this, vindex(member.next));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::rbegin() noexcept -> reverse_iterator
+auto circular_view<T, E, EV>::rbegin() noexcept -> reverse_iterator
 {
     return reverse_iterator(std::move(end()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::rbegin() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::rbegin() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(end()));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::rend() noexcept -> reverse_iterator
+auto circular_view<T, E, EV>::rend() noexcept -> reverse_iterator
 {
     return reverse_iterator(std::move(begin()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::rend() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::rend() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(begin()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::crbegin() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::crbegin() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(end()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::crend() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::crend() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(begin()));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::first_segment() noexcept -> segment
+auto circular_view<T, E, EV>::first_segment() noexcept -> segment
 {
     return (empty())
         ? segment()
@@ -414,8 +515,8 @@ auto circular_view<T, E>::first_segment() noexcept -> segment
                      member.data + index(back_index()) + 1));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::first_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::first_segment() const noexcept -> const_segment
 {
     return (empty())
         ? const_segment()
@@ -426,9 +527,9 @@ constexpr auto circular_view<T, E>::first_segment() const noexcept -> const_segm
                            member.data + index(back_index()) + 1));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::last_segment() noexcept -> segment
+auto circular_view<T, E, EV>::last_segment() noexcept -> segment
 {
     return wraparound() && (index(member.next) < size())
         ? segment(member.data,
@@ -436,8 +537,8 @@ auto circular_view<T, E>::last_segment() noexcept -> segment
         : segment();
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::last_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::last_segment() const noexcept -> const_segment
 {
     return wraparound() && (index(member.next) < size())
         ? const_segment(member.data,
@@ -445,9 +546,9 @@ constexpr auto circular_view<T, E>::last_segment() const noexcept -> const_segme
         : const_segment();
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::first_unused_segment() noexcept -> segment
+auto circular_view<T, E, EV>::first_unused_segment() noexcept -> segment
 {
     return (full())
         ? segment()
@@ -455,8 +556,8 @@ auto circular_view<T, E>::first_unused_segment() noexcept -> segment
                   member.data + std::min(front_index(), capacity()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::first_unused_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::first_unused_segment() const noexcept -> const_segment
 {
     return (full())
         ? const_segment()
@@ -467,9 +568,9 @@ constexpr auto circular_view<T, E>::first_unused_segment() const noexcept -> con
                            member.data + capacity()));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::last_unused_segment() noexcept -> segment
+auto circular_view<T, E, EV>::last_unused_segment() noexcept -> segment
 {
     return (full() || !unused_wraparound())
         ? segment()
@@ -477,8 +578,8 @@ auto circular_view<T, E>::last_unused_segment() noexcept -> segment
                   member.data + index(front_index()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::last_unused_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::last_unused_segment() const noexcept -> const_segment
 {
     return (full() || !unused_wraparound())
         ? const_segment()
@@ -488,59 +589,59 @@ constexpr auto circular_view<T, E>::last_unused_segment() const noexcept -> cons
 
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::index(size_type position) const noexcept -> size_type
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::index(size_type position) const noexcept -> size_type
 {
     return member.modulo(position, member.capacity());
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::vindex(size_type position) const noexcept -> size_type
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::vindex(size_type position) const noexcept -> size_type
 {
     return member.modulo(position, 2 * member.capacity());
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::front_index() const noexcept -> size_type
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::front_index() const noexcept -> size_type
 {
     return member.next - member.size;
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::back_index() const noexcept -> size_type
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::back_index() const noexcept -> size_type
 {
     return member.next - 1;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::at(size_type position) noexcept -> reference
+auto circular_view<T, E, EV>::at(size_type position) noexcept -> reference
 {
     return member.data[index(position)];
 }
 
-template <typename T, std::size_t E>
-constexpr auto circular_view<T, E>::at(size_type position) const noexcept -> const_reference
+template <typename T, std::size_t E, typename EV>
+constexpr auto circular_view<T, E, EV>::at(size_type position) const noexcept -> const_reference
 {
     return member.data[index(position)];
 }
 
-template <typename T, std::size_t E>
-constexpr bool circular_view<T, E>::wraparound() const noexcept
+template <typename T, std::size_t E, typename EV>
+constexpr bool circular_view<T, E, EV>::wraparound() const noexcept
 {
     return index(front_index()) > index(back_index());
 }
 
-template <typename T, std::size_t E>
-constexpr bool circular_view<T, E>::unused_wraparound() const noexcept
+template <typename T, std::size_t E, typename EV>
+constexpr bool circular_view<T, E, EV>::unused_wraparound() const noexcept
 {
     return front_index() > capacity();
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::rotate_range(size_type lower_length,
-                                       size_type upper_length) noexcept(vista::detail::is_nothrow_swappable<value_type>::value)
+void circular_view<T, E, EV>::rotate_range(size_type lower_length,
+                                           size_type upper_length) noexcept(vista::detail::is_nothrow_swappable<value_type>::value)
 {
     // Based on Gries-Mills block swapping rotate
     if (lower_length == 0 || upper_length == 0)
@@ -562,18 +663,102 @@ void circular_view<T, E>::rotate_range(size_type lower_length,
     swap_range(position - lower_length, position, lower_length);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::swap_range(size_type lhs,
-                                     size_type rhs,
-                                     size_type length) noexcept(vista::detail::is_nothrow_swappable<value_type>::value)
+void circular_view<T, E, EV>::swap_range(size_type lhs,
+                                         size_type rhs,
+                                         size_type length) noexcept(vista::detail::is_nothrow_swappable<value_type>::value)
 {
     for (size_type k = 0; k < length; ++k)
     {
         using std::swap;
         swap(at(lhs + k), at(rhs + k));
     }
- }
+}
+
+template <typename T, std::size_t E, typename EV>
+VISTA_CXX14_CONSTEXPR
+void circular_view<T, E, EV>::move_range(size_type from,
+                                         size_type to,
+                                         size_type length) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    // Overlapping ranges must be moved in the direction that reads each
+    // element before it is overwritten. Ranges can only overlap when the
+    // distance between them is less than half the capacity.
+    const bool backward = index(to + capacity() - from) < index(from + capacity() - to);
+    if (VISTA_IS_CONSTANT_EVALUATED())
+    {
+        // std::memmove cannot be used in constant expressions
+        move_range(from, to, length, backward, std::false_type{});
+    }
+    else
+    {
+        move_range(from, to, length, backward, std::is_trivially_copyable<value_type>{});
+    }
+}
+
+template <typename T, std::size_t E, typename EV>
+VISTA_CXX14_CONSTEXPR
+void circular_view<T, E, EV>::move_range(size_type from,
+                                         size_type to,
+                                         size_type length,
+                                         bool backward,
+                                         std::false_type) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    if (backward)
+    {
+        while (length > 0)
+        {
+            --length;
+            at(to + length) = std::move(at(from + length));
+        }
+    }
+    else
+    {
+        for (size_type k = 0; k < length; ++k)
+        {
+            at(to + k) = std::move(at(from + k));
+        }
+    }
+}
+
+template <typename T, std::size_t E, typename EV>
+void circular_view<T, E, EV>::move_range(size_type from,
+                                         size_type to,
+                                         size_type length,
+                                         bool backward,
+                                         std::true_type) noexcept
+{
+    // Move contiguous chunks where neither source nor target wraps around
+    if (backward)
+    {
+        while (length > 0)
+        {
+            const auto source_end = index(from + length - 1) + 1;
+            const auto target_end = index(to + length - 1) + 1;
+            const auto chunk = std::min(length, std::min(source_end, target_end));
+            std::memmove(member.data + target_end - chunk,
+                         member.data + source_end - chunk,
+                         chunk * sizeof(value_type));
+            length -= chunk;
+        }
+    }
+    else
+    {
+        while (length > 0)
+        {
+            const auto source = index(from);
+            const auto target = index(to);
+            const auto chunk = std::min(length, capacity() - std::max(source, target));
+            std::memmove(member.data + target,
+                         member.data + source,
+                         chunk * sizeof(value_type));
+            from += chunk;
+            to += chunk;
+            length -= chunk;
+        }
+    }
+}
 
 //-----------------------------------------------------------------------------
 // circular_view<T>::member_storage fixed extent
@@ -582,52 +767,52 @@ void circular_view<T, E>::swap_range(size_type lhs,
 // std::addressof(x) and std::distance(a, b) are not constexpr before C++17, so
 // we use &x and b - a instead, which ought to work for ContiguousIterator.
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
-constexpr circular_view<T, E>::member_storage<T1, E1>::member_storage() noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, E1>::member_storage() noexcept
     : data(nullptr),
       size(0),
       next(0)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
-constexpr circular_view<T, E>::member_storage<T1, E1>::member_storage(pointer data,
-                                                                      size_type size,
-                                                                      size_type next) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, E1>::member_storage(pointer data,
+                                                                          size_type size,
+                                                                          size_type next) noexcept
     : data(data),
       size(size),
       next(next)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
-constexpr circular_view<T, E>::member_storage<T1, E1>::member_storage(const member_storage& other,
-                                                                      pointer data) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, E1>::member_storage(const member_storage& other,
+                                                                          pointer data) noexcept
     : data(data),
       size(other.size),
       next(other.next)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
 template <typename OtherT, std::size_t OtherExtent>
-constexpr circular_view<T, E>::member_storage<T1, E1>::member_storage(const circular_view<OtherT, OtherExtent>& other) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, E1>::member_storage(const circular_view<OtherT, OtherExtent, EV>& other) noexcept
     : data(other.member.data),
       size(other.member.size),
       next(other.member.next)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
 template <typename ContiguousIterator>
 VISTA_CXX14_CONSTEXPR
-circular_view<T, E>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
-                                                            ContiguousIterator end) noexcept
+circular_view<T, E, EV>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
+                                                                ContiguousIterator end) noexcept
     : data(begin == end ? nullptr : &*begin),
       size(0),
       next(size_type(end - begin))
@@ -635,14 +820,14 @@ circular_view<T, E>::member_storage<T1, E1>::member_storage(ContiguousIterator b
     assert(size_type(end - begin) == capacity());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
 template <typename ContiguousIterator>
 VISTA_CXX14_CONSTEXPR
-circular_view<T, E>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
-                                                            ContiguousIterator end,
-                                                            ContiguousIterator first,
-                                                            size_type length) noexcept
+circular_view<T, E, EV>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
+                                                                ContiguousIterator end,
+                                                                ContiguousIterator first,
+                                                                size_type length) noexcept
     : data(begin == end ? nullptr : &*begin),
       size(length),
       next(size_type(first - begin) + length)
@@ -650,44 +835,44 @@ circular_view<T, E>::member_storage<T1, E1>::member_storage(ContiguousIterator b
     assert(size_type(end - begin) == capacity());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
 template <std::size_t N>
-constexpr circular_view<T, E>::member_storage<T1, E1>::member_storage(value_type (&array)[N]) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, E1>::member_storage(value_type (&array)[N]) noexcept
     : member_storage(array, array + N)
 {
     static_assert(N >= E1, "N cannot be smaller than capacity");
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
-constexpr auto circular_view<T, E>::member_storage<T1, E1>::capacity() const noexcept -> size_type
+constexpr auto circular_view<T, E, EV>::member_storage<T1, E1>::capacity() const noexcept -> size_type
 {
     return E1;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::member_storage<T1, E1>::capacity(size_type) noexcept
+void circular_view<T, E, EV>::member_storage<T1, E1>::capacity(size_type) noexcept
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::member_storage<T1, E1>::assign(const member_storage& other,
-                                                         pointer data) noexcept
+void circular_view<T, E, EV>::member_storage<T1, E1>::assign(const member_storage& other,
+                                                             pointer data) noexcept
 {
     this->data = data;
     this->size = other.size;
     this->next = other.next;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1, std::size_t E1>
-constexpr auto circular_view<T, E>::member_storage<T1, E1>::modulo(size_type value,
-                                                                   size_type n) const noexcept -> size_type
+constexpr auto circular_view<T, E, EV>::member_storage<T1, E1>::modulo(size_type value,
+                                                                       size_type n) const noexcept -> size_type
 {
     return ((n & (n - 1)) == 0)
         ? value & (n - 1) // Power of two
@@ -698,9 +883,9 @@ constexpr auto circular_view<T, E>::member_storage<T1, E1>::modulo(size_type val
 // circular_view<T>::member_storage dynamic extent
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
-constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storage() noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::member_storage() noexcept
     : data(nullptr),
       cap(0),
       size(0),
@@ -708,12 +893,12 @@ constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storag
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
-constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storage(pointer data,
-                                                                                  size_type capacity,
-                                                                                  size_type size,
-                                                                                  size_type next) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::member_storage(pointer data,
+                                                                                      size_type capacity,
+                                                                                      size_type size,
+                                                                                      size_type next) noexcept
     : data(data),
       cap(capacity),
       size(size),
@@ -721,10 +906,10 @@ constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storag
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
-constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storage(const member_storage& other,
-                                                                                  pointer data) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::member_storage(const member_storage& other,
+                                                                                      pointer data) noexcept
     : data(data),
       cap(other.cap),
       size(other.size),
@@ -732,10 +917,10 @@ constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storag
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
 template <typename OtherT, std::size_t OtherExtent>
-constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storage(const circular_view<OtherT, OtherExtent>& other) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::member_storage(const circular_view<OtherT, OtherExtent, EV>& other) noexcept
     : data(other.member.data),
       cap(other.member.capacity()),
       size(other.member.size),
@@ -743,11 +928,11 @@ constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storag
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
 template <typename ContiguousIterator>
-constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
-                                                                                  ContiguousIterator end) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
+                                                                                      ContiguousIterator end) noexcept
     : data(begin == end ? nullptr : &*begin),
       cap(size_type(end - begin)),
       size(0),
@@ -755,13 +940,13 @@ constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storag
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
 template <typename ContiguousIterator>
-constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
-                                                                                  ContiguousIterator end,
-                                                                                  ContiguousIterator first,
-                                                                                  size_type length) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
+                                                                                      ContiguousIterator end,
+                                                                                      ContiguousIterator first,
+                                                                                      size_type length) noexcept
     : data(begin == end ? nullptr : &*begin),
       cap(size_type(end - begin)),
       size(length),
@@ -769,34 +954,34 @@ constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storag
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
 template <std::size_t N>
-constexpr circular_view<T, E>::member_storage<T1, dynamic_extent>::member_storage(value_type (&array)[N]) noexcept
+constexpr circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::member_storage(value_type (&array)[N]) noexcept
     : member_storage(array, array + N)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
-constexpr auto circular_view<T, E>::member_storage<T1, dynamic_extent>::capacity() const noexcept -> size_type
+constexpr auto circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::capacity() const noexcept -> size_type
 {
     return cap;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::member_storage<T1, dynamic_extent>::capacity(size_type value) noexcept
+void circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::capacity(size_type value) noexcept
 {
     cap = value;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
 VISTA_CXX14_CONSTEXPR
-void circular_view<T, E>::member_storage<T1, dynamic_extent>::assign(const member_storage& other,
-                                                                     pointer data) noexcept
+void circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::assign(const member_storage& other,
+                                                                         pointer data) noexcept
 {
     this->data = data;
     capacity(other.capacity());
@@ -804,10 +989,10 @@ void circular_view<T, E>::member_storage<T1, dynamic_extent>::assign(const membe
     this->next = other.next;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename T1>
-constexpr auto circular_view<T, E>::member_storage<T1, dynamic_extent>::modulo(size_type value,
-                                                                               size_type n) const noexcept -> size_type
+constexpr auto circular_view<T, E, EV>::member_storage<T1, dynamic_extent>::modulo(size_type value,
+                                                                                   size_type n) const noexcept -> size_type
 {
     return ((n & (n - 1)) == 0)
         ? value & (n - 1) // Power of two
@@ -818,19 +1003,19 @@ constexpr auto circular_view<T, E>::member_storage<T1, dynamic_extent>::modulo(s
 // circular_view<T>::basic_iterator
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr circular_view<T, E>::basic_iterator<U>::basic_iterator(view_pointer parent,
-                                                                 size_type position) noexcept
+constexpr circular_view<T, E, EV>::basic_iterator<U>::basic_iterator(view_pointer parent,
+                                                                     size_type position) noexcept
     : parent(parent),
       current(position)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator++() noexcept -> iterator_type&
+auto circular_view<T, E, EV>::basic_iterator<U>::operator++() noexcept -> iterator_type&
 {
     assert(parent);
 
@@ -838,10 +1023,10 @@ auto circular_view<T, E>::basic_iterator<U>::operator++() noexcept -> iterator_t
     return *this;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator++(int) noexcept -> iterator_type
+auto circular_view<T, E, EV>::basic_iterator<U>::operator++(int) noexcept -> iterator_type
 {
     assert(parent);
 
@@ -850,10 +1035,10 @@ auto circular_view<T, E>::basic_iterator<U>::operator++(int) noexcept -> iterato
     return before;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator--() noexcept -> iterator_type&
+auto circular_view<T, E, EV>::basic_iterator<U>::operator--() noexcept -> iterator_type&
 {
     assert(parent);
 
@@ -861,10 +1046,10 @@ auto circular_view<T, E>::basic_iterator<U>::operator--() noexcept -> iterator_t
     return *this;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator--(int) noexcept -> iterator_type
+auto circular_view<T, E, EV>::basic_iterator<U>::operator--(int) noexcept -> iterator_type
 {
     assert(parent);
 
@@ -873,10 +1058,10 @@ auto circular_view<T, E>::basic_iterator<U>::operator--(int) noexcept -> iterato
     return before;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator+=(difference_type amount) noexcept -> iterator_type&
+auto circular_view<T, E, EV>::basic_iterator<U>::operator+=(difference_type amount) noexcept -> iterator_type&
 {
     assert(parent);
 
@@ -884,19 +1069,19 @@ auto circular_view<T, E>::basic_iterator<U>::operator+=(difference_type amount)
     return *this;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr auto circular_view<T, E>::basic_iterator<U>::operator+(difference_type amount) const noexcept -> iterator_type
+constexpr auto circular_view<T, E, EV>::basic_iterator<U>::operator+(difference_type amount) const noexcept -> iterator_type
 {
     VISTA_CXX14(assert(parent));
 
     return iterator_type(parent, current + amount);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator-=(difference_type amount) noexcept -> iterator_type&
+auto circular_view<T, E, EV>::basic_iterator<U>::operator-=(difference_type amount) noexcept -> iterator_type&
 {
     assert(parent);
 
@@ -904,66 +1089,66 @@ auto circular_view<T, E>::basic_iterator<U>::operator-=(difference_type amount)
     return *this;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr auto circular_view<T, E>::basic_iterator<U>::operator-(difference_type amount) const noexcept -> iterator_type
+constexpr auto circular_view<T, E, EV>::basic_iterator<U>::operator-(difference_type amount) const noexcept -> iterator_type
 {
     VISTA_CXX14(assert(parent));
 
     return iterator_type(parent, current - amount);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr auto circular_view<T, E>::basic_iterator<U>::operator-(const iterator_type& other) const noexcept -> difference_type
+constexpr auto circular_view<T, E, EV>::basic_iterator<U>::operator-(const iterator_type& other) const noexcept -> difference_type
 {
     VISTA_CXX14(assert(parent));
 
     return current - other.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator[](difference_type amount) noexcept -> reference
+auto circular_view<T, E, EV>::basic_iterator<U>::operator[](difference_type amount) noexcept -> reference
 {
     assert(parent);
 
     return parent->at(current + amount);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator-> () noexcept -> pointer
+auto circular_view<T, E, EV>::basic_iterator<U>::operator-> () noexcept -> pointer
 {
     assert(parent);
 
     return *parent->at(current);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
 VISTA_CXX14_CONSTEXPR
-auto circular_view<T, E>::basic_iterator<U>::operator*() noexcept -> reference
+auto circular_view<T, E, EV>::basic_iterator<U>::operator*() noexcept -> reference
 {
     assert(parent);
 
     return parent->at(current);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr auto circular_view<T, E>::basic_iterator<U>::operator*() const noexcept -> const_reference
+constexpr auto circular_view<T, E, EV>::basic_iterator<U>::operator*() const noexcept -> const_reference
 {
     VISTA_CXX14(assert(parent));
 
     return parent->at(current);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr bool circular_view<T, E>::basic_iterator<U>::operator==(const iterator_type& other) const noexcept
+constexpr bool circular_view<T, E, EV>::basic_iterator<U>::operator==(const iterator_type& other) const noexcept
 {
     VISTA_CXX14(assert(parent));
     VISTA_CXX14(assert(parent == other.parent));
@@ -971,16 +1156,16 @@ constexpr bool circular_view<T, E>::basic_iterator<U>::operator==(const iterator
     return current == other.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr bool circular_view<T, E>::basic_iterator<U>::operator!=(const iterator_type& other) const noexcept
+constexpr bool circular_view<T, E, EV>::basic_iterator<U>::operator!=(const iterator_type& other) const noexcept
 {
     return !operator==(other);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr bool circular_view<T, E>::basic_iterator<U>::operator<(const iterator_type& other) const noexcept
+constexpr bool circular_view<T, E, EV>::basic_iterator<U>::operator<(const iterator_type& other) const noexcept
 {
     VISTA_CXX14(assert(parent));
     VISTA_CXX14(assert(parent == other.parent));
@@ -988,9 +1173,9 @@ constexpr bool circular_view<T, E>::basic_iterator<U>::operator<(const iterator_
     return current < other.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr bool circular_view<T, E>::basic_iterator<U>::operator<=(const iterator_type& other) const noexcept
+constexpr bool circular_view<T, E, EV>::basic_iterator<U>::operator<=(const iterator_type& other) const noexcept
 {
     VISTA_CXX14(assert(parent));
     VISTA_CXX14(assert(parent == other.parent));
@@ -998,9 +1183,9 @@ constexpr bool circular_view<T, E>::basic_iterator<U>::operator<=(const iterator
     return current <= other.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr bool circular_view<T, E>::basic_iterator<U>::operator>(const iterator_type& other) const noexcept
+constexpr bool circular_view<T, E, EV>::basic_iterator<U>::operator>(const iterator_type& other) const noexcept
 {
     VISTA_CXX14(assert(parent));
     VISTA_CXX14(assert(parent == other.parent));
@@ -1008,9 +1193,9 @@ constexpr bool circular_view<T, E>::basic_iterator<U>::operator>(const iterator_
     return current > other.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename EV>
 template <typename U>
-constexpr bool circular_view<T, E>::basic_iterator<U>::operator>=(const iterator_type& other) const noexcept
+constexpr bool circular_view<T, E, EV>::basic_iterator<U>::operator>=(const iterator_type& other) const noexcept
 {
     VISTA_CXX14(assert(parent));
     VISTA_CXX14(assert(parent == other.parent));
@@ -1018,4 +1203,203 @@ constexpr bool circular_view<T, E>::basic_iterator<U>::operator>=(const iterator
     return current >= other.current;
 }
 
+//-----------------------------------------------------------------------------
+// Sorted algorithms
+//-----------------------------------------------------------------------------
+
+namespace detail
+{
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+std::size_t lower_bound_sorted_offset(const circular_view<T, E, EV>& view,
+                                      const U& needle,
+                                      Compare compare) noexcept
+{
+    const auto first = view.first_segment();
+    const auto last = view.last_segment();
+    // The last element of the first segment determines which segment to search
+    if (!last.empty() && compare(first.back(), needle))
+    {
+        return first.size() + (vista::lower_bound_sorted(last.begin(), last.end(), needle, compare) - last.begin());
+    }
+    return vista::lower_bound_sorted(first.begin(), first.end(), needle, compare) - first.begin();
+}
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+std::size_t upper_bound_sorted_offset(const circular_view<T, E, EV>& view,
+                                      const U& needle,
+                                      Compare compare) noexcept
+{
+    const auto first = view.first_segment();
+    const auto last = view.last_segment();
+    // The last element of the first segment determines which segment to search
+    if (!last.empty() && !compare(needle, first.back()))
+    {
+        return first.size() + (vista::upper_bound_sorted(last.begin(), last.end(), needle, compare) - last.begin());
+    }
+    return vista::upper_bound_sorted(first.begin(), first.end(), needle, compare) - first.begin();
+}
+
+} // namespace detail
+
+template <typename T, std::size_t E, typename EV, typename U>
+VISTA_CXX14_CONSTEXPR
+auto lower_bound_sorted(circular_view<T, E, EV>& view,
+                        const U& needle) noexcept -> typename circular_view<T, E, EV>::iterator
+{
+    return lower_bound_sorted(view, needle, vista::less<U>{});
+}
+
+template <typename T, std::size_t E, typename EV, typename U>
+VISTA_CXX14_CONSTEXPR
+auto lower_bound_sorted(const circular_view<T, E, EV>& view,
+                        const U& needle) noexcept -> typename circular_view<T, E, EV>::const_iterator
+{
+    return lower_bound_sorted(view, needle, vista::less<U>{});
+}
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+auto lower_bound_sorted(circular_view<T, E, EV>& view,
+                        const U& needle,
+                        Compare compare) noexcept -> typename circular_view<T, E, EV>::iterator
+{
+    const auto& immutable = view;
+    return view.begin() + detail::lower_bound_sorted_offset(immutable, needle, std::move(compare));
+}
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+auto lower_bound_sorted(const circular_view<T, E, EV>& view,
+                        const U& needle,
+                        Compare compare) noexcept -> typename circular_view<T, E, EV>::const_iterator
+{
+    return view.begin() + detail::lower_bound_sorted_offset(view, needle, std::move(compare));
+}
+
+template <typename T, std::size_t E, typename EV, typename U>
+VISTA_CXX14_CONSTEXPR
+auto upper_bound_sorted(circular_view<T, E, EV>& view,
+                        const U& needle) noexcept -> typename circular_view<T, E, EV>::iterator
+{
+    return upper_bound_sorted(view, needle, vista::less<U>{});
+}
+
+template <typename T, std::size_t E, typename EV, typename U>
+VISTA_CXX14_CONSTEXPR
+auto upper_bound_sorted(const circular_view<T, E, EV>& view,
+                        const U& needle) noexcept -> typename circular_view<T, E, EV>::const_iterator
+{
+    return upper_bound_sorted(view, needle, vista::less<U>{});
+}
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+auto upper_bound_sorted(circular_view<T, E, EV>& view,
+                        const U& needle,
+                        Compare compare) noexcept -> typename circular_view<T, E, EV>::iterator
+{
+    const auto& immutable = view;
+    return view.begin() + detail::upper_bound_sorted_offset(immutable, needle, std::move(compare));
+}
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+auto upper_bound_sorted(const circular_view<T, E, EV>& view,
+                        const U& needle,
+                        Compare compare) noexcept -> typename circular_view<T, E, EV>::const_iterator
+{
+    return view.begin() + detail::upper_bound_sorted_offset(view, needle, std::move(compare));
+}
+
+template <typename T, std::size_t E, typename EV, typename U>
+VISTA_CXX14_CONSTEXPR
+auto equal_range_sorted(circular_view<T, E, EV>& view,
+                        const U& needle) noexcept -> pair<typename circular_view<T, E, EV>::iterator,
+                                                          typename circular_view<T, E, EV>::iterator>
+{
+    return equal_range_sorted(view, needle, vista::less<U>{});
+}
+
+template <typename T, std::size_t E, typename EV, typename U>
+VISTA_CXX14_CONSTEXPR
+auto equal_range_sorted(const circular_view<T, E, EV>& view,
+                        const U& needle) noexcept -> pair<typename circular_view<T, E, EV>::const_iterator,
+                                                          typename circular_view<T, E, EV>::const_iterator>
+{
+    return equal_range_sorted(view, needle, vista::less<U>{});
+}
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+auto equal_range_sorted(circular_view<T, E, EV>& view,
+                        const U& needle,
+                        Compare compare) noexcept -> pair<typename circular_view<T, E, EV>::iterator,
+                                                          typename circular_view<T, E, EV>::iterator>
+{
+    return { lower_bound_sorted(view, needle, compare),
+             upper_bound_sorted(view, needle, compare) };
+}
+
+template <typename T, std::size_t E, typename EV, typename U, typename Compare>
+VISTA_CXX14_CONSTEXPR
+auto equal_range_sorted(const circular_view<T, E, EV>& view,
+                        const U& needle,
+                        Compare compare) noexcept -> pair<typename circular_view<T, E, EV>::const_iterator,
+                                                          typename circular_view<T, E, EV>::const_iterator>
+{
+    return { lower_bound_sorted(view, needle, compare),
+             upper_bound_sorted(view, needle, compare) };
+}
+
+//-----------------------------------------------------------------------------
+// Erasure
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t E, typename EV, typename Predicate>
+VISTA_CXX14_CONSTEXPR
+auto erase_if(circular_view<T, E, EV>& view,
+              Predicate predicate) noexcept(std::is_nothrow_move_assignable<T>::value) -> typename circular_view<T, E, EV>::size_type
+{
+    static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
+
+    typename circular_view<T, E, EV>::segment segments[] = { view.first_segment(), view.last_segment() };
+    auto& first = segments[0];
+    auto& last = segments[1];
+
+    // The output position trails the input position, and jumps to the last
+    // segment when the first segment has been filled.
+    auto output = first.begin();
+    bool output_in_first = true;
+    for (auto& segment : segments)
+    {
+        for (auto input = segment.begin(); input != segment.end(); ++input)
+        {
+            if (predicate(*input))
+                continue;
+            if (output_in_first && output == first.end())
+            {
+                output = last.begin();
+                output_in_first = false;
+            }
+            if (output != input)
+            {
+                *output = std::move(*input);
+            }
+            ++output;
+        }
+    }
+    const auto kept = output_in_first
+        ? typename circular_view<T, E, EV>::size_type(output - first.begin())
+        : first.size() + (output - last.begin());
+    const auto removed = view.size() - kept;
+    if (removed > 0)
+    {
+        view.remove_back(removed);
+    }
+    return removed;
+}
+
 } // namespace vista
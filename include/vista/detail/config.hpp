@@ -25,6 +25,20 @@
 # define VISTA_CXX14_CONSTEXPR
 #endif
 
+// Evaluates to true during constant evaluation. Conservatively evaluates to
+// true if the compiler cannot tell, so the caller picks the constexpr path.
+
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_is_constant_evaluated)
+#  define VISTA_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+# endif
+#elif defined(__GNUC__) && (__GNUC__ >= 9)
+# define VISTA_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if !defined(VISTA_IS_CONSTANT_EVALUATED)
+# define VISTA_IS_CONSTANT_EVALUATED() true
+#endif
+
 namespace vista
 {
 
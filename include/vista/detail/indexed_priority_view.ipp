@@ -0,0 +1,213 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+
+namespace vista
+{
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+template <std::size_t N,
+          typename std::enable_if<(E == N || E == dynamic_extent), int>::type>
+VISTA_CXX14_CONSTEXPR
+indexed_priority_view<T, E, C, A>::indexed_priority_view(element_type (&values)[N],
+                                                         size_type (&indices)[2 * N]) noexcept
+    : indexed_priority_view(values, indices, N)
+{
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+indexed_priority_view<T, E, C, A>::indexed_priority_view(pointer values,
+                                                         size_type *indices,
+                                                         size_type capacity) noexcept
+    : member(values, indices, capacity)
+{
+    for (size_type handle = 0; handle < capacity; ++handle)
+    {
+        member.position[handle] = npos;
+    }
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr bool indexed_priority_view<T, E, C, A>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr bool indexed_priority_view<T, E, C, A>::full() const noexcept
+{
+    return size() == capacity();
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto indexed_priority_view<T, E, C, A>::capacity() const noexcept -> size_type
+{
+    return member.span.size();
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto indexed_priority_view<T, E, C, A>::size() const noexcept -> size_type
+{
+    return member.size;
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr bool indexed_priority_view<T, E, C, A>::contains(handle_type handle) const noexcept
+{
+    VISTA_CXX14(assert(handle < capacity()));
+    return member.position[handle] != npos;
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto indexed_priority_view<T, E, C, A>::operator[](handle_type handle) const noexcept -> const value_type&
+{
+    VISTA_CXX14(assert(contains(handle)));
+    return member.span[handle];
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto indexed_priority_view<T, E, C, A>::top() const noexcept -> const value_type&
+{
+    return member.span[top_handle()];
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto indexed_priority_view<T, E, C, A>::top_handle() const noexcept -> handle_type
+{
+    VISTA_CXX14(assert(!empty()));
+    return member.heap[0];
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::push(handle_type handle, value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(!contains(handle));
+    member.span[handle] = std::move(input);
+    const auto slot = member.size;
+    ++member.size;
+    place(slot, handle);
+    sift_up(slot);
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::pop() noexcept
+{
+    erase(top_handle());
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::update(handle_type handle, value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(contains(handle));
+    const bool upwards = member.comparator(member.span[handle], input);
+    member.span[handle] = std::move(input);
+    if (upwards)
+    {
+        sift_up(member.position[handle]);
+    }
+    else
+    {
+        sift_down(member.position[handle]);
+    }
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::erase(handle_type handle) noexcept
+{
+    assert(contains(handle));
+    const auto slot = member.position[handle];
+    member.position[handle] = npos;
+    --member.size;
+    if (slot == member.size)
+        return;
+
+    // Fill the hole with the last handle, which may belong either above or
+    // below the hole.
+    const auto moved = member.heap[member.size];
+    place(slot, moved);
+    sift_up(slot);
+    sift_down(member.position[moved]);
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::clear() noexcept
+{
+    for (size_type slot = 0; slot < member.size; ++slot)
+    {
+        member.position[member.heap[slot]] = npos;
+    }
+    member.size = 0;
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr bool indexed_priority_view<T, E, C, A>::before(handle_type lhs, handle_type rhs) const noexcept
+{
+    return member.comparator(member.span[lhs], member.span[rhs]);
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::place(size_type slot, handle_type handle) noexcept
+{
+    member.heap[slot] = handle;
+    member.position[handle] = slot;
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::sift_up(size_type slot) noexcept
+{
+    const auto handle = member.heap[slot];
+    while (slot > 0)
+    {
+        const auto parent = (slot - 1) / A;
+        if (!before(member.heap[parent], handle))
+            break;
+        place(slot, member.heap[parent]);
+        slot = parent;
+    }
+    place(slot, handle);
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void indexed_priority_view<T, E, C, A>::sift_down(size_type slot) noexcept
+{
+    const auto handle = member.heap[slot];
+    while (true)
+    {
+        const auto first = A * slot + 1;
+        if (first >= member.size)
+            break;
+        const auto last = (member.size - first > A) ? first + A : member.size;
+        auto best = first;
+        for (auto child = first + 1; child < last; ++child)
+        {
+            if (before(member.heap[best], member.heap[child]))
+            {
+                best = child;
+            }
+        }
+        if (!before(handle, member.heap[best]))
+            break;
+        place(slot, member.heap[best]);
+        slot = best;
+    }
+    place(slot, handle);
+}
+
+} // namespace vista
@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
 #include <memory>
 #include <vista/detail/config.hpp>
 
@@ -50,6 +51,32 @@ void destroy_at(T *p)
 
 #endif
 
+#if __cpp_lib_assume_aligned >= 201811L
+
+using std::assume_aligned;
+
+#else
+
+// Informs the compiler that the pointer is aligned to N bytes, which enables
+// aligned vector loads and stores.
+
+template <std::size_t N, typename T>
+T *assume_aligned(T *p) noexcept
+{
+#if defined(__GNUC__)
+    return static_cast<T *>(__builtin_assume_aligned(p, N));
+#else
+    return p;
+#endif
+}
+
+#endif
+
+inline bool is_aligned(const void *p, std::size_t alignment) noexcept
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
 } // namespace detail
 } // namespace vista
 
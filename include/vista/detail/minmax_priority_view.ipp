@@ -0,0 +1,326 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+
+namespace vista
+{
+
+template <typename T, std::size_t E, typename C>
+template <std::size_t N,
+          typename std::enable_if<(E == N || E == dynamic_extent), int>::type>
+constexpr minmax_priority_view<T, E, C>::minmax_priority_view(element_type (&array)[N]) noexcept
+    : member(array, array + N)
+{
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr minmax_priority_view<T, E, C>::minmax_priority_view(pointer data,
+                                                              size_type size) noexcept
+    : member(data, data + size)
+{
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+minmax_priority_view<T, E, C>::minmax_priority_view(pointer data,
+                                                    size_type capacity,
+                                                    size_type size) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+    : member(data, data + capacity)
+{
+    assert(size <= capacity);
+    member.last += size;
+    // Bottom-up construction in linear time
+    for (size_type index = size / 2; index > 0; --index)
+    {
+        const auto current = index - 1;
+        value_type value = std::move(data[current]);
+        if (is_min_level(current))
+            sift_down<false>(current, value);
+        else
+            sift_down<true>(current, value);
+    }
+}
+
+template <typename T, std::size_t E, typename C>
+template <typename ContiguousIterator>
+constexpr minmax_priority_view<T, E, C>::minmax_priority_view(ContiguousIterator begin,
+                                                              ContiguousIterator end) noexcept
+    : member(&*begin, &*end)
+{
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr bool minmax_priority_view<T, E, C>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr bool minmax_priority_view<T, E, C>::full() const noexcept
+{
+    return size() == capacity();
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr auto minmax_priority_view<T, E, C>::size() const noexcept -> size_type
+{
+    return member.last - member.span.data();
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr auto minmax_priority_view<T, E, C>::capacity() const noexcept -> size_type
+{
+    return member.span.size();
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr auto minmax_priority_view<T, E, C>::min() const noexcept -> const value_type&
+{
+    VISTA_CXX14(assert(size() > 0));
+    return member.span.front();
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr auto minmax_priority_view<T, E, C>::max() const noexcept -> const value_type&
+{
+    VISTA_CXX14(assert(size() > 0));
+    return member.span[max_index()];
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+void minmax_priority_view<T, E, C>::push(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(!full());
+    auto data = member.span.data();
+    size_type index = size();
+    ++member.last;
+    if (index > 0)
+    {
+        // The element is first compared with its parent to determine whether
+        // it belongs on the min levels or the max levels.
+        const auto parent = (index - 1) / 2;
+        if (is_min_level(index))
+        {
+            if (before<true>(input, data[parent]))
+            {
+                data[index] = std::move(data[parent]);
+                index = parent;
+                sift_up<true>(index, input);
+            }
+            else
+            {
+                sift_up<false>(index, input);
+            }
+        }
+        else
+        {
+            if (before<false>(input, data[parent]))
+            {
+                data[index] = std::move(data[parent]);
+                index = parent;
+                sift_up<false>(index, input);
+            }
+            else
+            {
+                sift_up<true>(index, input);
+            }
+        }
+    }
+    else
+    {
+        data[index] = std::move(input);
+    }
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+void minmax_priority_view<T, E, C>::pop_min() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(!empty());
+    --member.last;
+    if (!empty())
+    {
+        value_type value = std::move(*member.last);
+        sift_down<false>(0, value);
+    }
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+void minmax_priority_view<T, E, C>::pop_max() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(!empty());
+    const auto index = max_index();
+    --member.last;
+    if (index < size())
+    {
+        value_type value = std::move(*member.last);
+        sift_down<true>(index, value);
+    }
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+void minmax_priority_view<T, E, C>::replace_min(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(!empty());
+    sift_down<false>(0, input);
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+void minmax_priority_view<T, E, C>::replace_max(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(!empty());
+    const auto index = max_index();
+    if (index > 0)
+    {
+        // Unlike pop_max(), the input may be smaller than the smallest element
+        auto& root = member.span.front();
+        if (before<false>(input, root))
+        {
+            value_type smallest = std::move(root);
+            root = std::move(input);
+            input = std::move(smallest);
+        }
+    }
+    sift_down<true>(index, input);
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+auto minmax_priority_view<T, E, C>::pushpop_min(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value) -> value_type
+{
+    if (empty() || !before<false>(min(), input))
+        return input;
+
+    value_type result = std::move(member.span.front());
+    replace_min(std::move(input));
+    return result;
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+auto minmax_priority_view<T, E, C>::pushpop_max(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value) -> value_type
+{
+    if (empty() || !before<true>(max(), input))
+        return input;
+
+    value_type result = std::move(member.span[max_index()]);
+    replace_max(std::move(input));
+    return result;
+}
+
+template <typename T, std::size_t E, typename C>
+constexpr auto minmax_priority_view<T, E, C>::max_index() const noexcept -> size_type
+{
+    // The largest element is either the root or one of its children
+    return (size() < 2)
+        ? 0
+        : ((size() == 2) || !member.comparator(member.span[1], member.span[2])) ? 1 : 2;
+}
+
+template <typename T, std::size_t E, typename C>
+VISTA_CXX14_CONSTEXPR
+bool minmax_priority_view<T, E, C>::is_min_level(size_type index) noexcept
+{
+    // Grandparents are on the same kind of level
+    while (index > 2)
+    {
+        index = (index - 3) / 4;
+    }
+    return index == 0;
+}
+
+// Checks if lhs belongs above rhs on a max level (if IsMax) or on a min level.
+
+template <typename T, std::size_t E, typename C>
+template <bool IsMax>
+constexpr bool minmax_priority_view<T, E, C>::before(const value_type& lhs,
+                                                     const value_type& rhs) const noexcept
+{
+    return IsMax ? member.comparator(rhs, lhs) : member.comparator(lhs, rhs);
+}
+
+// Moves value up through the grandparents from the hole at index.
+
+template <typename T, std::size_t E, typename C>
+template <bool IsMax>
+VISTA_CXX14_CONSTEXPR
+void minmax_priority_view<T, E, C>::sift_up(size_type index,
+                                            value_type& value) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    auto data = member.span.data();
+    while (index > 2)
+    {
+        const auto grandparent = (index - 3) / 4;
+        if (!before<IsMax>(value, data[grandparent]))
+            break;
+        data[index] = std::move(data[grandparent]);
+        index = grandparent;
+    }
+    data[index] = std::move(value);
+}
+
+// Moves value down from the hole at index.
+
+template <typename T, std::size_t E, typename C>
+template <bool IsMax>
+VISTA_CXX14_CONSTEXPR
+void minmax_priority_view<T, E, C>::sift_down(size_type index,
+                                              value_type& value) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    auto data = member.span.data();
+    const auto length = size();
+    while (true)
+    {
+        const auto child = 2 * index + 1;
+        if (child >= length)
+            break;
+
+        // Find the most extreme among the children and grandchildren
+        auto best = child;
+        if (child + 1 < length && before<IsMax>(data[child + 1], data[best]))
+        {
+            best = child + 1;
+        }
+        const auto grandchild = 2 * child + 1;
+        const auto grandchild_end = (length > grandchild + 4) ? grandchild + 4 : length;
+        for (auto current = grandchild; current < grandchild_end; ++current)
+        {
+            if (before<IsMax>(data[current], data[best]))
+            {
+                best = current;
+            }
+        }
+
+        if (!before<IsMax>(data[best], value))
+            break;
+
+        data[index] = std::move(data[best]);
+        index = best;
+        if (best < grandchild)
+            break;
+
+        // The value may violate the order of the opposite level in between
+        auto& parent = data[(best - 1) / 2];
+        if (before<IsMax>(parent, value))
+        {
+            value_type other = std::move(parent);
+            parent = std::move(value);
+            value = std::move(other);
+        }
+    }
+    data[index] = std::move(value);
+}
+
+} // namespace vista
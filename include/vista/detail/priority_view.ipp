@@ -9,81 +9,188 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <vista/algorithm.hpp>
+#include <vista/utility.hpp> // swap
 
 namespace vista
 {
 
-template <typename T, std::size_t E, typename C>
+template <typename T, std::size_t E, typename C, std::size_t A>
 template <std::size_t N,
           typename std::enable_if<(E == N || E == dynamic_extent), int>::type>
-constexpr priority_view<T, E, C>::priority_view(element_type (&array)[N]) noexcept
+constexpr priority_view<T, E, C, A>::priority_view(element_type (&array)[N]) noexcept
     : member(array, array + N)
 {
 }
 
-template <typename T, std::size_t E, typename C>
-constexpr priority_view<T, E, C>::priority_view(pointer data,
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr priority_view<T, E, C, A>::priority_view(pointer data,
                                                 size_type size) noexcept
     : member(data, data + size)
 {
 }
 
-template <typename T, std::size_t E, typename C>
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+priority_view<T, E, C, A>::priority_view(pointer data,
+                                         size_type capacity,
+                                         size_type size) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+    : member(data, data + capacity)
+{
+    assert(size <= capacity);
+    member.last += size;
+    vista::make_heap<false, A>(member.span.data(), member.last, member.comparator);
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
 template <typename ContiguousIterator>
-constexpr priority_view<T, E, C>::priority_view(ContiguousIterator begin,
+constexpr priority_view<T, E, C, A>::priority_view(ContiguousIterator begin,
                                                 ContiguousIterator end) noexcept
     : member(&*begin, &*end)
 {
 }
 
-template <typename T, std::size_t E, typename C>
-constexpr bool priority_view<T, E, C>::empty() const noexcept
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr bool priority_view<T, E, C, A>::empty() const noexcept
 {
     return size() == 0;
 }
 
-template <typename T, std::size_t E, typename C>
-constexpr bool priority_view<T, E, C>::full() const noexcept
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr bool priority_view<T, E, C, A>::full() const noexcept
 {
     return size() == capacity();
 }
 
-template <typename T, std::size_t E, typename C>
-constexpr auto priority_view<T, E, C>::size() const noexcept -> size_type
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto priority_view<T, E, C, A>::size() const noexcept -> size_type
 {
     return member.last - member.span.data();
 }
 
-template <typename T, std::size_t E, typename C>
-constexpr auto priority_view<T, E, C>::capacity() const noexcept -> size_type
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto priority_view<T, E, C, A>::capacity() const noexcept -> size_type
 {
     return member.span.size();
 }
 
-template <typename T, std::size_t E, typename C>
-constexpr auto priority_view<T, E, C>::top() const noexcept -> const value_type&
+template <typename T, std::size_t E, typename C, std::size_t A>
+constexpr auto priority_view<T, E, C, A>::top() const noexcept -> const value_type&
 {
     VISTA_CXX14(assert(size() > 0));
     return member.span.front();
 }
 
-template <typename T, std::size_t E, typename C>
+template <typename T, std::size_t E, typename C, std::size_t A>
 VISTA_CXX14_CONSTEXPR
-void priority_view<T, E, C>::push(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+void priority_view<T, E, C, A>::push(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
 {
     assert(!full());
     *member.last = std::move(input);
     ++member.last;
-    vista::push_heap(member.span.data(), member.last, member.comparator);
+    vista::push_heap<false, A>(member.span.data(), member.last, member.comparator);
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+template <typename ForwardIterator>
+VISTA_CXX14_CONSTEXPR
+void priority_view<T, E, C, A>::push(ForwardIterator first, ForwardIterator last) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value && std::is_nothrow_assignable<value_type&, decltype(*first)>::value)
+{
+    const auto old_size = size();
+    auto end = member.last;
+    for (; first != last; ++first)
+    {
+        assert(end != member.span.data() + capacity());
+        *end = *first;
+        ++end;
+    }
+    const size_type count = end - member.last;
+
+    // Incremental insertion takes up to logarithmic time per element, so the
+    // heap is rebuilt in linear time when the batch is not small.
+    if (count > old_size / 2)
+    {
+        member.last = end;
+        vista::make_heap<false, A>(member.span.data(), member.last, member.comparator);
+    }
+    else
+    {
+        while (member.last != end)
+        {
+            ++member.last;
+            vista::push_heap<false, A>(member.span.data(), member.last, member.comparator);
+        }
+    }
 }
 
-template <typename T, std::size_t E, typename C>
+template <typename T, std::size_t E, typename C, std::size_t A>
 VISTA_CXX14_CONSTEXPR
-void priority_view<T, E, C>::pop() noexcept (std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+void priority_view<T, E, C, A>::pop() noexcept (std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
 {
     assert(!empty());
-    vista::pop_heap(member.span.data(), member.last, member.comparator);
+    vista::pop_heap<false, A>(member.span.data(), member.last, member.comparator);
     --member.last;
 }
 
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+void priority_view<T, E, C, A>::replace_top(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    assert(!empty());
+    member.span.front() = std::move(input);
+    vista::detail::sift_down_heap<false, A>(member.span.data(), size(), 0, member.comparator);
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+auto priority_view<T, E, C, A>::pushpop(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value) -> value_type
+{
+    if (empty() || !member.comparator(input, top()))
+        return input;
+
+    value_type result = std::move(member.span.front());
+    replace_top(std::move(input));
+    return result;
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+template <typename OutputIterator>
+VISTA_CXX14_CONSTEXPR
+OutputIterator priority_view<T, E, C, A>::pop_n(size_type count, OutputIterator output) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value && std::is_nothrow_assignable<decltype(*output), value_type&&>::value)
+{
+    assert(count <= size());
+    pointer end = member.last;
+    for (size_type k = 0; k < count; ++k)
+    {
+        vista::pop_heap<false, A>(member.span.data(), member.last, member.comparator);
+        --member.last;
+    }
+    // Removed elements are stored backwards with the topmost element last
+    while (end != member.last)
+    {
+        --end;
+        *output = std::move(*end);
+        ++output;
+    }
+    return output;
+}
+
+template <typename T, std::size_t E, typename C, std::size_t A>
+VISTA_CXX14_CONSTEXPR
+auto priority_view<T, E, C, A>::drain_sorted() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value) -> segment
+{
+    const auto count = size();
+    // Heap sort places the topmost element last
+    vista::sort_heap<false, A>(member.span.data(), member.last, member.comparator);
+    // Reverse so the topmost element is first
+    pointer first = member.span.data();
+    pointer last = member.last;
+    while ((first != last) && (first != --last))
+    {
+        vista::swap<false>(*first, *last);
+        ++first;
+    }
+    member.last = member.span.data();
+    return segment(member.span.data(), count);
+}
+
 } // namespace vista
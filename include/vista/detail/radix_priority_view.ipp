@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <vista/detail/bit.hpp>
+
+namespace vista
+{
+
+template <typename K, typename T, std::size_t E>
+template <std::size_t N,
+          typename std::enable_if<(E == N || E == dynamic_extent), int>::type>
+constexpr radix_priority_view<K, T, E>::radix_priority_view(node_type (&array)[N]) noexcept
+    : member(array, array + N)
+{
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr radix_priority_view<K, T, E>::radix_priority_view(pointer data,
+                                                           size_type size) noexcept
+    : member(data, data + size)
+{
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr bool radix_priority_view<K, T, E>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr bool radix_priority_view<K, T, E>::full() const noexcept
+{
+    return size() == capacity();
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr auto radix_priority_view<K, T, E>::size() const noexcept -> size_type
+{
+    return member.size;
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr auto radix_priority_view<K, T, E>::capacity() const noexcept -> size_type
+{
+    return member.span.size();
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr auto radix_priority_view<K, T, E>::lower_bound() const noexcept -> key_type
+{
+    return member.last;
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr auto radix_priority_view<K, T, E>::top() const noexcept -> const value_type&
+{
+    VISTA_CXX14(assert(!empty()));
+    return member.buckets[0]
+        ? member.buckets[0]->value
+        : member.smallest[lowest_bucket()]->value;
+}
+
+template <typename K, typename T, std::size_t E>
+VISTA_CXX14_CONSTEXPR
+void radix_priority_view<K, T, E>::push(key_type key, mapped_type mapped) noexcept(std::is_nothrow_move_assignable<mapped_type>::value)
+{
+    assert(!full());
+    assert(empty() || key >= member.last);
+
+    node_type *node = member.spare;
+    if (node)
+    {
+        member.spare = node->next;
+    }
+    else
+    {
+        node = member.unused;
+        ++member.unused;
+    }
+    node->value.first = key;
+    node->value.second = std::move(mapped);
+    if (empty())
+    {
+        member.last = key;
+    }
+    link(node);
+    ++member.size;
+}
+
+template <typename K, typename T, std::size_t E>
+VISTA_CXX14_CONSTEXPR
+void radix_priority_view<K, T, E>::pop() noexcept
+{
+    assert(!empty());
+
+    if (!member.buckets[0])
+    {
+        redistribute();
+    }
+    node_type *node = member.buckets[0];
+    member.buckets[0] = node->next;
+    node->next = member.spare;
+    member.spare = node;
+    --member.size;
+}
+
+template <typename K, typename T, std::size_t E>
+VISTA_CXX14_CONSTEXPR
+void radix_priority_view<K, T, E>::clear() noexcept
+{
+    for (auto& bucket : member.buckets)
+    {
+        bucket = nullptr;
+    }
+    member.occupied = 0;
+    member.spare = nullptr;
+    member.unused = member.span.data();
+    member.size = 0;
+}
+
+template <typename K, typename T, std::size_t E>
+VISTA_CXX14_CONSTEXPR
+auto radix_priority_view<K, T, E>::bucket_index(key_type key, key_type last) noexcept -> size_type
+{
+    // Bit width of the highest differing bit
+    return 64 - vista::detail::countl_zero(std::uint64_t(key ^ last));
+}
+
+template <typename K, typename T, std::size_t E>
+VISTA_CXX14_CONSTEXPR
+void radix_priority_view<K, T, E>::link(node_type *node) noexcept
+{
+    const auto index = bucket_index(node->value.first, member.last);
+    if (index > 0)
+    {
+        if (!member.buckets[index] || node->value.first < member.smallest_key[index])
+        {
+            member.smallest[index] = node;
+            member.smallest_key[index] = node->value.first;
+        }
+        member.occupied |= std::uint64_t(1) << (index - 1);
+    }
+    node->next = member.buckets[index];
+    member.buckets[index] = node;
+}
+
+template <typename K, typename T, std::size_t E>
+constexpr auto radix_priority_view<K, T, E>::lowest_bucket() const noexcept -> size_type
+{
+    // Lowest non-empty bucket. The modulo only matters when no bucket is
+    // occupied, and keeps the index within the buckets.
+    VISTA_CXX14(assert(member.occupied != 0));
+    return size_type(vista::detail::countr_zero(member.occupied)) % (bucket_count - 1) + 1;
+}
+
+template <typename K, typename T, std::size_t E>
+VISTA_CXX14_CONSTEXPR
+void radix_priority_view<K, T, E>::redistribute() noexcept
+{
+    assert(member.occupied != 0);
+    const auto index = lowest_bucket();
+    node_type *node = member.buckets[index];
+    member.buckets[index] = nullptr;
+    member.occupied &= member.occupied - 1;
+
+    member.last = member.smallest_key[index];
+
+    // All keys in the bucket share the bits above index with the smallest
+    // key, so they are moved to lower buckets.
+    while (node)
+    {
+        node_type *next = node->next;
+        link(node);
+        node = next;
+    }
+}
+
+} // namespace vista
@@ -181,4 +181,543 @@ constexpr auto span<T, E>::cend() const noexcept -> const_iterator
     return member.tail;
 }
 
+//-----------------------------------------------------------------------------
+// strided_span<T>::basic_iterator
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr strided_span<T, E, S>::basic_iterator<U>::basic_iterator(pointer head,
+                                                                   difference_type index,
+                                                                   size_type stride) noexcept
+    : member(head, index, stride)
+{
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr auto strided_span<T, E, S>::basic_iterator<U>::stride() const noexcept -> size_type
+{
+    return static_cast<const detail::extent_storage<S, 0>&>(member).value();
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+VISTA_CXX14_CONSTEXPR
+auto strided_span<T, E, S>::basic_iterator<U>::operator++() noexcept -> iterator_type&
+{
+    ++member.index;
+    return *this;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+VISTA_CXX14_CONSTEXPR
+auto strided_span<T, E, S>::basic_iterator<U>::operator++(int) noexcept -> iterator_type
+{
+    auto result = *this;
+    ++*this;
+    return result;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+VISTA_CXX14_CONSTEXPR
+auto strided_span<T, E, S>::basic_iterator<U>::operator--() noexcept -> iterator_type&
+{
+    --member.index;
+    return *this;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+VISTA_CXX14_CONSTEXPR
+auto strided_span<T, E, S>::basic_iterator<U>::operator--(int) noexcept -> iterator_type
+{
+    auto result = *this;
+    --*this;
+    return result;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+VISTA_CXX14_CONSTEXPR
+auto strided_span<T, E, S>::basic_iterator<U>::operator+=(difference_type amount) noexcept -> iterator_type&
+{
+    member.index += amount;
+    return *this;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr auto strided_span<T, E, S>::basic_iterator<U>::operator+(difference_type amount) const noexcept -> iterator_type
+{
+    return iterator_type(member.head, member.index + amount, stride());
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+VISTA_CXX14_CONSTEXPR
+auto strided_span<T, E, S>::basic_iterator<U>::operator-=(difference_type amount) noexcept -> iterator_type&
+{
+    member.index -= amount;
+    return *this;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr auto strided_span<T, E, S>::basic_iterator<U>::operator-(difference_type amount) const noexcept -> iterator_type
+{
+    return iterator_type(member.head, member.index - amount, stride());
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr auto strided_span<T, E, S>::basic_iterator<U>::operator-(const iterator_type& other) const noexcept -> difference_type
+{
+    return member.index - other.member.index;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr auto strided_span<T, E, S>::basic_iterator<U>::operator[](difference_type position) const noexcept -> reference
+{
+    return member.head[(member.index + position) * difference_type(stride())];
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr auto strided_span<T, E, S>::basic_iterator<U>::operator->() const noexcept -> pointer
+{
+    return &member.head[member.index * difference_type(stride())];
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr auto strided_span<T, E, S>::basic_iterator<U>::operator*() const noexcept -> reference
+{
+    return member.head[member.index * difference_type(stride())];
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr bool strided_span<T, E, S>::basic_iterator<U>::operator==(const iterator_type& other) const noexcept
+{
+    return member.index == other.member.index;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr bool strided_span<T, E, S>::basic_iterator<U>::operator!=(const iterator_type& other) const noexcept
+{
+    return !(*this == other);
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr bool strided_span<T, E, S>::basic_iterator<U>::operator<(const iterator_type& other) const noexcept
+{
+    return member.index < other.member.index;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr bool strided_span<T, E, S>::basic_iterator<U>::operator<=(const iterator_type& other) const noexcept
+{
+    return member.index <= other.member.index;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr bool strided_span<T, E, S>::basic_iterator<U>::operator>(const iterator_type& other) const noexcept
+{
+    return member.index > other.member.index;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename U>
+constexpr bool strided_span<T, E, S>::basic_iterator<U>::operator>=(const iterator_type& other) const noexcept
+{
+    return member.index >= other.member.index;
+}
+
+//-----------------------------------------------------------------------------
+// strided_span
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t E, std::size_t S>
+template <bool Constraint,
+          typename std::enable_if<Constraint, int>::type>
+constexpr strided_span<T, E, S>::strided_span() noexcept
+    : member(nullptr, 0, (S == dynamic_extent) ? 1 : S)
+{
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename OtherT,
+          std::size_t OtherExtent,
+          std::size_t OtherStride,
+          typename std::enable_if<(E == OtherExtent || E == dynamic_extent) && (S == OtherStride || S == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type>
+constexpr strided_span<T, E, S>::strided_span(const strided_span<OtherT, OtherExtent, OtherStride>& other) noexcept
+    : member(other.data(), other.size(), other.stride())
+{
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <typename OtherT,
+          std::size_t OtherExtent,
+          typename std::enable_if<(E == OtherExtent || E == dynamic_extent) && (S == 1 || S == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type>
+constexpr strided_span<T, E, S>::strided_span(span<OtherT, OtherExtent> other) noexcept
+    : member(other.data(), other.size(), 1)
+{
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <bool Constraint,
+          typename std::enable_if<Constraint, int>::type>
+constexpr strided_span<T, E, S>::strided_span(pointer data, size_type size) noexcept
+    : member(data, size, S)
+{
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr strided_span<T, E, S>::strided_span(pointer data, size_type size, size_type stride) noexcept
+    : member(data, size, stride)
+{
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr bool strided_span<T, E, S>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::size() const noexcept -> size_type
+{
+    return static_cast<const detail::extent_storage<E, 0>&>(member).value();
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::stride() const noexcept -> size_type
+{
+    return static_cast<const detail::extent_storage<S, 1>&>(member).value();
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::data() const noexcept -> pointer
+{
+    return member.head;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::front() const noexcept -> reference
+{
+    return *member.head;
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::back() const noexcept -> reference
+{
+    return operator[](size() - 1);
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::operator[](size_type position) const noexcept -> reference
+{
+    return member.head[position * stride()];
+}
+
+template <typename T, std::size_t E, std::size_t S>
+template <std::size_t Offset, std::size_t Count>
+constexpr auto strided_span<T, E, S>::subspan() const noexcept -> strided_span<element_type, Count, S>
+{
+    VISTA_CXX14(assert(Offset <= size()));
+    VISTA_CXX14(assert(Count == dynamic_extent || Count <= size() - Offset));
+
+    // Avoid forming a pointer beyond the end of the underlying storage
+    return strided_span<element_type, Count, S>((Offset < size()) ? member.head + Offset * stride() : member.head,
+                                                (Count == dynamic_extent) ? (size() - Offset) : Count,
+                                                stride());
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::begin() const noexcept -> iterator
+{
+    return iterator(member.head, 0, stride());
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::cbegin() const noexcept -> const_iterator
+{
+    return const_iterator(member.head, 0, stride());
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::end() const noexcept -> iterator
+{
+    return iterator(member.head, difference_type(size()), stride());
+}
+
+template <typename T, std::size_t E, std::size_t S>
+constexpr auto strided_span<T, E, S>::cend() const noexcept -> const_iterator
+{
+    return const_iterator(member.head, difference_type(size()), stride());
+}
+
+//-----------------------------------------------------------------------------
+// matrix_span
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+template <bool Constraint,
+          typename std::enable_if<Constraint, int>::type>
+constexpr matrix_span<T, R, C, RS>::matrix_span(pointer data) noexcept
+    : member(data, R, C, RS)
+{
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr matrix_span<T, R, C, RS>::matrix_span(pointer data,
+                                                size_type rows,
+                                                size_type columns) noexcept
+    : member(data, rows, columns, (RS == dynamic_extent) ? columns : RS)
+{
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr matrix_span<T, R, C, RS>::matrix_span(pointer data,
+                                                size_type rows,
+                                                size_type columns,
+                                                size_type row_stride) noexcept
+    : member(data, rows, columns, row_stride)
+{
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr bool matrix_span<T, R, C, RS>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::size() const noexcept -> size_type
+{
+    return rows() * columns();
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::rows() const noexcept -> size_type
+{
+    return static_cast<const detail::extent_storage<R, 0>&>(member).value();
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::columns() const noexcept -> size_type
+{
+    return static_cast<const detail::extent_storage<C, 1>&>(member).value();
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::row_stride() const noexcept -> size_type
+{
+    return static_cast<const detail::extent_storage<RS, 2>&>(member).value();
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::data() const noexcept -> pointer
+{
+    return member.head;
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::operator()(size_type row, size_type column) const noexcept -> reference
+{
+    return member.head[row * row_stride() + column];
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::row(size_type position) const noexcept -> row_type
+{
+    return row_type(member.head + position * row_stride(), columns());
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::column(size_type position) const noexcept -> column_type
+{
+    return column_type(member.head + position, rows(), row_stride());
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+template <std::size_t RowOffset,
+          std::size_t ColumnOffset,
+          std::size_t RowCount,
+          std::size_t ColumnCount>
+constexpr auto matrix_span<T, R, C, RS>::submatrix() const noexcept -> matrix_span<element_type, RowCount, ColumnCount, RS>
+{
+    VISTA_CXX14(assert(RowOffset <= rows()));
+    VISTA_CXX14(assert(ColumnOffset <= columns()));
+    VISTA_CXX14(assert(RowCount == dynamic_extent || RowCount <= rows() - RowOffset));
+    VISTA_CXX14(assert(ColumnCount == dynamic_extent || ColumnCount <= columns() - ColumnOffset));
+
+    return matrix_span<element_type, RowCount, ColumnCount, RS>(
+        member.head + RowOffset * row_stride() + ColumnOffset,
+        (RowCount == dynamic_extent) ? (rows() - RowOffset) : RowCount,
+        (ColumnCount == dynamic_extent) ? (columns() - ColumnOffset) : ColumnCount,
+        row_stride());
+}
+
+template <typename T, std::size_t R, std::size_t C, std::size_t RS>
+constexpr auto matrix_span<T, R, C, RS>::submatrix(size_type row_offset,
+                                                   size_type column_offset,
+                                                   size_type row_count,
+                                                   size_type column_count) const noexcept
+    -> matrix_span<element_type, dynamic_extent, dynamic_extent, RS>
+{
+    VISTA_CXX14(assert(row_offset + row_count <= rows()));
+    VISTA_CXX14(assert(column_offset + column_count <= columns()));
+
+    return matrix_span<element_type, dynamic_extent, dynamic_extent, RS>(
+        member.head + row_offset * row_stride() + column_offset,
+        row_count,
+        column_count,
+        row_stride());
+}
+
+//-----------------------------------------------------------------------------
+// aligned_span
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t E, std::size_t A>
+template <bool Constraint,
+          typename std::enable_if<Constraint, int>::type>
+aligned_span<T, E, A>::aligned_span() noexcept
+    : member(nullptr, 0)
+{
+}
+
+template <typename T, std::size_t E, std::size_t A>
+template <typename OtherT,
+          std::size_t OtherExtent,
+          std::size_t OtherAlignment,
+          typename std::enable_if<(E == OtherExtent || E == dynamic_extent) && (OtherAlignment >= A) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type>
+aligned_span<T, E, A>::aligned_span(const aligned_span<OtherT, OtherExtent, OtherAlignment>& other) noexcept
+    : member(other.data(), other.size())
+{
+}
+
+template <typename T, std::size_t E, std::size_t A>
+template <typename OtherT,
+          std::size_t OtherExtent,
+          typename std::enable_if<(E == OtherExtent || E == dynamic_extent) && (A <= alignof(OtherT)) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type>
+aligned_span<T, E, A>::aligned_span(span<OtherT, OtherExtent> other) noexcept
+    : member(other.data(), other.size())
+{
+}
+
+template <typename T, std::size_t E, std::size_t A>
+template <typename OtherT,
+          std::size_t OtherExtent,
+          typename std::enable_if<(E == OtherExtent || E == dynamic_extent) && (A > alignof(OtherT)) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type>
+aligned_span<T, E, A>::aligned_span(span<OtherT, OtherExtent> other) noexcept
+    : member(other.data(), other.size())
+{
+    assert(detail::is_aligned(member.head, A));
+}
+
+template <typename T, std::size_t E, std::size_t A>
+aligned_span<T, E, A>::aligned_span(pointer data, size_type size) noexcept
+    : member(data, size)
+{
+    assert(detail::is_aligned(data, A));
+}
+
+template <typename T, std::size_t E, std::size_t A>
+aligned_span<T, E, A>::aligned_span(pointer first, pointer last) noexcept
+    : member(first, size_type(last - first))
+{
+    assert(detail::is_aligned(first, A));
+}
+
+template <typename T, std::size_t E, std::size_t A>
+template <std::size_t M,
+          typename std::enable_if<(E == M || E == dynamic_extent), int>::type>
+aligned_span<T, E, A>::aligned_span(element_type (&array)[M]) noexcept
+    : member(array, M)
+{
+    assert(detail::is_aligned(array, A));
+}
+
+template <typename T, std::size_t E, std::size_t A>
+bool aligned_span<T, E, A>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::size() const noexcept -> size_type
+{
+    return static_cast<const detail::extent_storage<E, 0>&>(member).value();
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::data() const noexcept -> pointer
+{
+    return detail::assume_aligned<A>(member.head);
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::front() const noexcept -> reference
+{
+    return *data();
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::back() const noexcept -> reference
+{
+    return data()[size() - 1];
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::operator[](difference_type position) const noexcept -> reference
+{
+    return data()[position];
+}
+
+template <typename T, std::size_t E, std::size_t A>
+template <std::size_t Offset, std::size_t Count>
+auto aligned_span<T, E, A>::subspan() const noexcept -> aligned_span<element_type, Count, detail::offset_alignment(A, Offset * sizeof(T))>
+{
+    assert(Offset <= size());
+    assert(Count == dynamic_extent || Count <= size() - Offset);
+
+    return aligned_span<element_type, Count, detail::offset_alignment(A, Offset * sizeof(T))>(
+        data() + Offset,
+        (Count == dynamic_extent) ? (size() - Offset) : Count);
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::begin() const noexcept -> iterator
+{
+    return data();
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::cbegin() const noexcept -> const_iterator
+{
+    return data();
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::end() const noexcept -> iterator
+{
+    return data() + size();
+}
+
+template <typename T, std::size_t E, std::size_t A>
+auto aligned_span<T, E, A>::cend() const noexcept -> const_iterator
+{
+    return data() + size();
+}
+
 } // namespace vista
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <vista/algorithm.hpp>
+
+namespace vista
+{
+
+template <typename T, std::size_t K, typename C>
+top_k<T, K, C>::top_k() noexcept
+    : storage(),
+      heap(storage.data(), K)
+{
+}
+
+// Custom copy constructor is needed to set view pointer correctly.
+template <typename T, std::size_t K, typename C>
+top_k<T, K, C>::top_k(const top_k& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+    : storage(other.storage),
+      heap(storage.data(), K, other.size())
+{
+}
+
+// Custom copy assignment is needed to set view pointer correctly.
+template <typename T, std::size_t K, typename C>
+auto top_k<T, K, C>::operator=(const top_k& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> top_k&
+{
+    storage = other.storage;
+    heap = view(storage.data(), K, other.size());
+    return *this;
+}
+
+template <typename T, std::size_t K, typename C>
+bool top_k<T, K, C>::empty() const noexcept
+{
+    return heap.empty();
+}
+
+template <typename T, std::size_t K, typename C>
+bool top_k<T, K, C>::full() const noexcept
+{
+    return heap.full();
+}
+
+template <typename T, std::size_t K, typename C>
+auto top_k<T, K, C>::size() const noexcept -> size_type
+{
+    return heap.size();
+}
+
+template <typename T, std::size_t K, typename C>
+auto top_k<T, K, C>::capacity() const noexcept -> size_type
+{
+    return K;
+}
+
+template <typename T, std::size_t K, typename C>
+auto top_k<T, K, C>::threshold() const noexcept -> const value_type&
+{
+    return heap.top();
+}
+
+template <typename T, std::size_t K, typename C>
+bool top_k<T, K, C>::push(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value)
+{
+    if (!heap.full())
+    {
+        heap.push(std::move(input));
+        return true;
+    }
+    if (!value_compare{}(heap.top(), input))
+        return false;
+
+    heap.replace_top(std::move(input));
+    return true;
+}
+
+template <typename T, std::size_t K, typename C>
+auto top_k<T, K, C>::sort() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value) -> segment
+{
+    const auto count = size();
+    // Heap sort with the reversed order places the largest element first
+    vista::sort_heap(storage.data(), storage.data() + count, reverse_compare{});
+    clear();
+    return segment(storage.data(), count);
+}
+
+template <typename T, std::size_t K, typename C>
+void top_k<T, K, C>::clear() noexcept
+{
+    heap = view(storage.data(), K);
+}
+
+} // namespace vista
@@ -12,6 +12,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <type_traits>
+#include <utility>
 
 namespace vista
 {
@@ -59,6 +60,14 @@ struct is_nothrow_swappable
 
 #endif
 
+// Evictor is invoked with a reference to the element about to be overwritten
+
+template <typename Evictor, typename Reference>
+struct is_nothrow_evictor
+    : std::integral_constant<bool, noexcept(std::declval<Evictor&>()(std::declval<Reference>()))>
+{
+};
+
 } // namespace detail
 } // namespace vista
 
@@ -0,0 +1,235 @@
+#ifndef VISTA_INDEXED_PRIORITY_VIEW_HPP
+#define VISTA_INDEXED_PRIORITY_VIEW_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vista/functional.hpp> // less
+#include <vista/span.hpp>
+
+namespace vista
+{
+
+//! @brief Indexed priority view.
+//!
+//! A view that turns contiguous memory into a priority queue whose elements
+//! can be found, changed, and removed by handle.
+//!
+//! A handle is an index into the value storage in the range [0, capacity()).
+//! Each handle can be in the priority view at most once. The heap itself
+//! consists of handles, and a position map from handle to heap slot is kept
+//! in the index storage. Elements are therefore never moved once inserted.
+//!
+//! Constant time lookup of the largest (by default) element, and logarithmic
+//! time insertion, update, and removal of any element.
+//!
+//! The default ordering can be changed with a user-provided compare predicate.
+//!
+//! The handles are organized as a d-ary heap where each handle has up to
+//! Arity children.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <typename T,
+          std::size_t Extent = dynamic_extent,
+          typename Compare = vista::less<T>,
+          std::size_t Arity = 2>
+class indexed_priority_view
+{
+    static_assert(Arity >= 2, "Arity must be at least two");
+
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<element_type>::type;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+    using handle_type = size_type;
+    using pointer = T*;
+
+    //! @brief Maximum number of children of each element.
+
+    static constexpr size_type arity = Arity;
+
+    //! @brief Creates empty indexed priority view.
+
+    constexpr indexed_priority_view() noexcept = default;
+
+    //! @brief Creates indexed priority view by copying.
+
+    constexpr indexed_priority_view(const indexed_priority_view&) noexcept = default;
+
+    //! @brief Creates indexed priority view by moving.
+
+    constexpr indexed_priority_view(indexed_priority_view&&) noexcept = default;
+
+    //! @brief Recreates indexed priority view by copying.
+
+    VISTA_CXX14_CONSTEXPR
+    indexed_priority_view& operator=(const indexed_priority_view&) noexcept = default;
+
+    //! @brief Recreates indexed priority view by moving.
+
+    VISTA_CXX14_CONSTEXPR
+    indexed_priority_view& operator=(indexed_priority_view&&) noexcept = default;
+
+    //! @brief Creates indexed priority view from arrays.
+    //!
+    //! The index array must have room for two indices per value.
+    //!
+    //! @post capacity() == N
+    //! @post size() == 0
+
+    template <std::size_t N,
+              typename std::enable_if<(Extent == N || Extent == dynamic_extent), int>::type = 0>
+    VISTA_CXX14_CONSTEXPR
+    indexed_priority_view(element_type (&values)[N],
+                          size_type (&indices)[2 * N]) noexcept;
+
+    //! @brief Creates indexed priority view from pointers and capacity.
+    //!
+    //! Linear time complexity in capacity, as the position map is initialized.
+    //!
+    //! @pre values points to capacity elements.
+    //! @pre indices points to 2 * capacity elements.
+    //! @post capacity() == capacity
+    //! @post size() == 0
+
+    VISTA_CXX14_CONSTEXPR
+    indexed_priority_view(pointer values,
+                          size_type *indices,
+                          size_type capacity) noexcept;
+
+    //! @brief Checks if view is empty.
+
+    constexpr bool empty() const noexcept;
+
+    //! @brief Checks if view is full.
+
+    constexpr bool full() const noexcept;
+
+    //! @brief Returns the maximum possible number of elements in the view.
+
+    constexpr size_type capacity() const noexcept;
+
+    //! @brief Returns the number of elements in the view.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Checks if handle is in the view.
+    //!
+    //! @pre handle < capacity()
+
+    constexpr bool contains(handle_type handle) const noexcept;
+
+    //! @brief Returns reference to element with handle.
+    //!
+    //! @pre contains(handle)
+
+    constexpr const value_type& operator[](handle_type handle) const noexcept;
+
+    //! @brief Returns reference to topmost element.
+    //!
+    //! @pre !empty()
+
+    constexpr const value_type& top() const noexcept;
+
+    //! @brief Returns handle of topmost element.
+    //!
+    //! @pre !empty()
+
+    constexpr handle_type top_handle() const noexcept;
+
+    //! @brief Inserts element with handle into proper position.
+    //!
+    //! @pre handle < capacity()
+    //! @pre !contains(handle)
+
+    VISTA_CXX14_CONSTEXPR
+    void push(handle_type handle, value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes the topmost element.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void pop() noexcept;
+
+    //! @brief Changes element with handle and moves it to proper position.
+    //!
+    //! Covers both increase-key and decrease-key.
+    //!
+    //! @pre contains(handle)
+
+    VISTA_CXX14_CONSTEXPR
+    void update(handle_type handle, value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes element with handle.
+    //!
+    //! @pre contains(handle)
+
+    VISTA_CXX14_CONSTEXPR
+    void erase(handle_type handle) noexcept;
+
+    //! @brief Removes all elements.
+    //!
+    //! Linear time complexity in size().
+    //!
+    //! @post size() == 0
+
+    VISTA_CXX14_CONSTEXPR
+    void clear() noexcept;
+
+private:
+    static constexpr size_type npos = size_type(-1);
+
+    constexpr bool before(handle_type, handle_type) const noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    void place(size_type slot, handle_type) noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    void sift_up(size_type slot) noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    void sift_down(size_type slot) noexcept;
+
+private:
+    struct member
+    {
+        constexpr member() noexcept = default;
+
+        constexpr member(pointer values, size_type *indices, size_type capacity) noexcept
+            : span(values, capacity),
+              heap(indices),
+              position(indices + capacity)
+        {
+        }
+
+        Compare comparator;
+        vista::span<T, Extent> span;
+        // Heap of handles ordered by their elements
+        size_type *heap = nullptr;
+        // Heap slot of each handle, or npos if absent
+        size_type *position = nullptr;
+        size_type size = 0;
+    } member;
+};
+
+template <typename T, std::size_t Extent, typename Compare, std::size_t Arity>
+constexpr std::size_t indexed_priority_view<T, Extent, Compare, Arity>::arity;
+
+template <typename T, std::size_t Extent, typename Compare, std::size_t Arity>
+constexpr std::size_t indexed_priority_view<T, Extent, Compare, Arity>::npos;
+
+} // namespace vista
+
+#include <vista/detail/indexed_priority_view.ipp>
+
+#endif // VISTA_INDEXED_PRIORITY_VIEW_HPP
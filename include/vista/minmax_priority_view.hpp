@@ -0,0 +1,226 @@
+#ifndef VISTA_MINMAX_PRIORITY_VIEW_HPP
+#define VISTA_MINMAX_PRIORITY_VIEW_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vista/functional.hpp> // less
+#include <vista/span.hpp>
+
+namespace vista
+{
+
+//! @brief Min-max priority view.
+//!
+//! A view that turns contiguous memory into a double-ended priority queue.
+//!
+//! Constant time lookup of both the smallest and the largest element.
+//!
+//! The default ordering can be changed with a user-provided compare predicate.
+//!
+//! The elements are organized as a min-max heap as described in "Min-Max
+//! Heaps and Generalized Priority Queues" (Atkinson et al., 1986). Elements
+//! on even levels are smaller than their descendants, and elements on odd
+//! levels are larger than their descendants.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <typename T,
+          std::size_t Extent = dynamic_extent,
+          typename Compare = vista::less<T>>
+class minmax_priority_view
+{
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<element_type>::type;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+    using pointer = T*;
+
+    //! @brief Creates empty min-max priority view.
+
+    constexpr minmax_priority_view() noexcept = default;
+
+    //! @brief Creates min-max priority view by copying.
+
+    constexpr minmax_priority_view(const minmax_priority_view&) noexcept = default;
+
+    //! @brief Creates min-max priority view by moving.
+
+    constexpr minmax_priority_view(minmax_priority_view&&) noexcept = default;
+
+    //! @brief Recreates min-max priority view by copying.
+
+    VISTA_CXX14_CONSTEXPR
+    minmax_priority_view& operator=(const minmax_priority_view&) noexcept = default;
+
+    //! @brief Recreates min-max priority view by moving.
+
+    VISTA_CXX14_CONSTEXPR
+    minmax_priority_view& operator=(minmax_priority_view&&) noexcept = default;
+
+    //! @brief Creates min-max priority view from array.
+
+    template <std::size_t N,
+              typename std::enable_if<(Extent == N || Extent == dynamic_extent), int>::type = 0>
+    explicit constexpr minmax_priority_view(element_type (&array)[N]) noexcept;
+
+    //! @brief Creates min-max priority view from pointer and size.
+
+    constexpr minmax_priority_view(pointer data, size_type size) noexcept;
+
+    //! @brief Creates min-max priority view from pointer and capacity, and
+    //!        adopts the first elements.
+    //!
+    //! The adopted elements are reorganized into a min-max heap in linear time.
+    //!
+    //! @pre size <= capacity
+
+    VISTA_CXX14_CONSTEXPR
+    minmax_priority_view(pointer data, size_type capacity, size_type size) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Creates min-max priority view from iterators.
+    //!
+    //! The view covers the range from @c begin to @c end.
+
+    template <typename ContiguousIterator>
+    constexpr minmax_priority_view(ContiguousIterator begin,
+                                   ContiguousIterator end) noexcept;
+
+    //! @brief Checks if min-max priority view is empty.
+
+    constexpr bool empty() const noexcept;
+
+    //! @brief Checks if min-max priority view is full.
+
+    constexpr bool full() const noexcept;
+
+    //! @brief Returns the number of elements in min-max priority view.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Returns the maximum possible number of elements in min-max priority view.
+
+    constexpr size_type capacity() const noexcept;
+
+    //! @brief Returns reference to smallest element.
+    //!
+    //! @pre size() > 0
+
+    constexpr const value_type& min() const noexcept;
+
+    //! @brief Returns reference to largest element.
+    //!
+    //! @pre size() > 0
+
+    constexpr const value_type& max() const noexcept;
+
+    //! @brief Inserts element and reorganizes the underlying storage.
+    //!
+    //! @pre capacity() > 0
+    //! @pre !full()
+
+    VISTA_CXX14_CONSTEXPR
+    void push(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes the smallest element.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void pop_min() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes the largest element.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void pop_max() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Replaces the smallest element and reorganizes the underlying storage.
+    //!
+    //! Same as pop_min() followed by push(input), but only moves the new
+    //! element down the heap once.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void replace_min(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Replaces the largest element and reorganizes the underlying storage.
+    //!
+    //! Same as pop_max() followed by push(input), but only moves the new
+    //! element down the heap once.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void replace_max(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Inserts element and removes the smallest element.
+    //!
+    //! Same as push(input) followed by pop_min(), but returns the removed
+    //! element. The input is returned immediately without modifying the view
+    //! if it would become the smallest element.
+    //!
+    //! Works on a full view.
+
+    VISTA_CXX14_CONSTEXPR
+    value_type pushpop_min(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Inserts element and removes the largest element.
+    //!
+    //! Same as push(input) followed by pop_max(), but returns the removed
+    //! element. The input is returned immediately without modifying the view
+    //! if it would become the largest element.
+    //!
+    //! Works on a full view, where it evicts the largest element.
+
+    VISTA_CXX14_CONSTEXPR
+    value_type pushpop_max(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+private:
+    constexpr size_type max_index() const noexcept;
+
+    static VISTA_CXX14_CONSTEXPR bool is_min_level(size_type) noexcept;
+
+    template <bool IsMax>
+    constexpr bool before(const value_type&, const value_type&) const noexcept;
+
+    template <bool IsMax>
+    VISTA_CXX14_CONSTEXPR
+    void sift_up(size_type, value_type&) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    template <bool IsMax>
+    VISTA_CXX14_CONSTEXPR
+    void sift_down(size_type, value_type&) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+private:
+    struct member
+    {
+        constexpr member() noexcept = default;
+
+        constexpr member(pointer begin, pointer end) noexcept
+            : span(begin, end),
+              last(begin)
+        {
+        }
+
+        Compare comparator;
+        vista::span<T, Extent> span;
+        pointer last = nullptr;
+    } member;
+};
+
+} // namespace vista
+
+#include <vista/detail/minmax_priority_view.ipp>
+
+#endif // VISTA_MINMAX_PRIORITY_VIEW_HPP
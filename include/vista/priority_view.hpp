@@ -25,19 +25,31 @@ namespace vista
 //!
 //! The default ordering can be changed with a user-provided compare predicate.
 //!
+//! The elements are organized as a d-ary heap where each element has up to
+//! Arity children. Higher arity gives a shallower heap, which reduces cache
+//! misses for large views.
+//!
 //! Violation of any precondition results in undefined behavior.
 
 template <typename T,
           std::size_t Extent = dynamic_extent,
-          typename Compare = vista::less<T>>
+          typename Compare = vista::less<T>,
+          std::size_t Arity = 2>
 class priority_view
 {
+    static_assert(Arity >= 2, "Arity must be at least two");
+
 public:
     using element_type = T;
     using value_type = typename std::remove_cv<element_type>::type;
     using value_compare = Compare;
     using size_type = std::size_t;
     using pointer = T*;
+    using segment = span<element_type>;
+
+    //! @brief Maximum number of children of each element.
+
+    static constexpr size_type arity = Arity;
 
     //! @brief Creates empty priority view.
 
@@ -51,6 +63,16 @@ public:
 
     constexpr priority_view(priority_view&&) noexcept = default;
 
+    //! @brief Recreates priority view by copying.
+
+    VISTA_CXX14_CONSTEXPR
+    priority_view& operator=(const priority_view&) noexcept = default;
+
+    //! @brief Recreates priority view by moving.
+
+    VISTA_CXX14_CONSTEXPR
+    priority_view& operator=(priority_view&&) noexcept = default;
+
     //! @brief Creates priority view from array.
 
     template <std::size_t N,
@@ -63,6 +85,19 @@ public:
 
     constexpr priority_view(pointer data, size_type size) noexcept;
 
+    //! @brief Creates priority view from pointer and size with existing elements.
+    //!
+    //! The view covers the range from @c data and @c capacity elements
+    //! forwards. The first @c size elements are adopted by the view and
+    //! reorganized into a heap.
+    //!
+    //! Linear time complexity.
+    //!
+    //! @pre size <= capacity
+
+    VISTA_CXX14_CONSTEXPR
+    priority_view(pointer data, size_type capacity, size_type size) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
     //! @brief Creates priority view from iterators.
     //!
     //! The view covers the range from @c begin to @c end.
@@ -101,6 +136,18 @@ public:
     VISTA_CXX14_CONSTEXPR
     void push(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
 
+    //! @brief Inserts elements and reorganizes the underlying storage.
+    //!
+    //! Elements are inserted one at a time if the number of inserted elements
+    //! is small compared to size(). Otherwise the elements are appended and
+    //! the entire heap is rebuilt in linear time.
+    //!
+    //! @pre capacity() - size() >= std::distance(first, last)
+
+    template <typename ForwardIterator>
+    VISTA_CXX14_CONSTEXPR
+    void push(ForwardIterator first, ForwardIterator last) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value && std::is_nothrow_assignable<value_type&, decltype(*first)>::value);
+
     //! @brief Removes the topmost element from the priority view.
     //!
     //! @pre capacity() > 0
@@ -109,6 +156,55 @@ public:
     VISTA_CXX14_CONSTEXPR
     void pop() noexcept (std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
 
+    //! @brief Replaces the topmost element and reorganizes the underlying storage.
+    //!
+    //! Same as pop() followed by push(input), but only moves the new element
+    //! down the heap once.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void replace_top(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Inserts element and removes the topmost element.
+    //!
+    //! Same as push(input) followed by pop(), but returns the removed element.
+    //! The input is returned immediately without modifying the priority view
+    //! if it would become the topmost element.
+    //!
+    //! Works on a full priority view.
+
+    VISTA_CXX14_CONSTEXPR
+    value_type pushpop(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes the best elements.
+    //!
+    //! The @c count topmost elements are moved to @c output in priority order,
+    //! with the topmost element first. The elements are extracted in place at
+    //! the end of the underlying storage before they are moved.
+    //!
+    //! Returns the output iterator past the last moved element.
+    //!
+    //! @pre count <= size()
+
+    template <typename OutputIterator>
+    VISTA_CXX14_CONSTEXPR
+    OutputIterator pop_n(size_type count, OutputIterator output) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value && std::is_nothrow_assignable<decltype(*output), value_type&&>::value);
+
+    //! @brief Removes all elements and returns them in priority order.
+    //!
+    //! The elements are sorted in place with heap sort and returned as a
+    //! contiguous segment with the topmost element first. The segment refers
+    //! to the underlying storage and remains valid until the next element is
+    //! pushed.
+    //!
+    //! Linearithmic time complexity.
+    //!
+    //! @post empty()
+
+    VISTA_CXX14_CONSTEXPR
+    segment drain_sorted() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
 private:
     struct member
     {
@@ -126,6 +222,9 @@ private:
     } member;
 };
 
+template <typename T, std::size_t Extent, typename Compare, std::size_t Arity>
+constexpr std::size_t priority_view<T, Extent, Compare, Arity>::arity;
+
 } // namespace vista
 
 #include <vista/detail/priority_view.ipp>
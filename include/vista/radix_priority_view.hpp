@@ -0,0 +1,207 @@
+#ifndef VISTA_RADIX_PRIORITY_VIEW_HPP
+#define VISTA_RADIX_PRIORITY_VIEW_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vista/span.hpp>
+#include <vista/utility.hpp>
+
+namespace vista
+{
+
+//! @brief Monotone priority view for unsigned integer keys.
+//!
+//! A view that turns contiguous memory into a priority queue where the keys of
+//! removed elements never decrease, such as timestamps in an event simulator.
+//!
+//! Constant time lookup of the element with the smallest key.
+//!
+//! The elements are organized as a radix heap. An element is placed in the
+//! bucket given by the highest bit where its key differs from the key of the
+//! last removed element. Elements in the lowest non-empty bucket are spread
+//! over the lower buckets when an element is removed and the smallest bucket
+//! is empty, and each element can only move down the buckets. Insertion
+//! therefore takes constant time, and removal takes amortized logarithmic time
+//! in the key range. The smallest element of each bucket is tracked, so the
+//! smallest element can be looked up in constant time.
+//!
+//! The underlying storage consists of nodes where the elements are kept in
+//! place, and only the links between nodes are changed.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <typename Key,
+          typename T,
+          std::size_t Extent = dynamic_extent>
+class radix_priority_view
+{
+    static_assert(std::is_unsigned<Key>::value, "Key must be an unsigned integer");
+    static_assert(std::numeric_limits<Key>::digits <= 64, "Key must be at most 64 bits");
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = vista::pair<key_type, mapped_type>;
+    using size_type = std::size_t;
+
+    //! @brief Storage node of an element.
+
+    struct node_type
+    {
+        value_type value;
+        node_type *next = nullptr;
+    };
+
+    using pointer = node_type*;
+
+    //! @brief Number of buckets.
+
+    static constexpr size_type bucket_count = std::numeric_limits<key_type>::digits + 1;
+
+    //! @brief Creates empty radix priority view.
+
+    constexpr radix_priority_view() noexcept = default;
+
+    //! @brief Creates radix priority view by copying.
+
+    constexpr radix_priority_view(const radix_priority_view&) noexcept = default;
+
+    //! @brief Creates radix priority view by moving.
+
+    constexpr radix_priority_view(radix_priority_view&&) noexcept = default;
+
+    //! @brief Recreates radix priority view by copying.
+
+    VISTA_CXX14_CONSTEXPR
+    radix_priority_view& operator=(const radix_priority_view&) noexcept = default;
+
+    //! @brief Recreates radix priority view by moving.
+
+    VISTA_CXX14_CONSTEXPR
+    radix_priority_view& operator=(radix_priority_view&&) noexcept = default;
+
+    //! @brief Creates radix priority view from array of nodes.
+
+    template <std::size_t N,
+              typename std::enable_if<(Extent == N || Extent == dynamic_extent), int>::type = 0>
+    explicit constexpr radix_priority_view(node_type (&array)[N]) noexcept;
+
+    //! @brief Creates radix priority view from pointer to nodes and size.
+
+    constexpr radix_priority_view(pointer data, size_type size) noexcept;
+
+    //! @brief Checks if radix priority view is empty.
+
+    constexpr bool empty() const noexcept;
+
+    //! @brief Checks if radix priority view is full.
+
+    constexpr bool full() const noexcept;
+
+    //! @brief Returns the number of elements in radix priority view.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Returns the maximum possible number of elements in radix priority view.
+
+    constexpr size_type capacity() const noexcept;
+
+    //! @brief Returns the lower bound of keys that can be inserted.
+    //!
+    //! The lower bound is the key of the most recently removed element, or
+    //! the key of the first inserted element if no element has been removed
+    //! since the view was empty.
+
+    constexpr key_type lower_bound() const noexcept;
+
+    //! @brief Returns reference to element with smallest key.
+    //!
+    //! Elements with the same key are returned in unspecified order.
+    //!
+    //! @pre !empty()
+
+    constexpr const value_type& top() const noexcept;
+
+    //! @brief Inserts element.
+    //!
+    //! Constant time complexity.
+    //!
+    //! @pre !full()
+    //! @pre key >= lower_bound() unless empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void push(key_type key, mapped_type mapped) noexcept(std::is_nothrow_move_assignable<mapped_type>::value);
+
+    //! @brief Removes element with smallest key.
+    //!
+    //! Amortized logarithmic time complexity in the range of keys.
+    //!
+    //! @pre !empty()
+
+    VISTA_CXX14_CONSTEXPR
+    void pop() noexcept;
+
+    //! @brief Removes all elements.
+    //!
+    //! @post size() == 0
+
+    VISTA_CXX14_CONSTEXPR
+    void clear() noexcept;
+
+private:
+    static VISTA_CXX14_CONSTEXPR size_type bucket_index(key_type key, key_type last) noexcept;
+
+    constexpr size_type lowest_bucket() const noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    void link(node_type *) noexcept;
+
+    VISTA_CXX14_CONSTEXPR
+    void redistribute() noexcept;
+
+private:
+    struct member
+    {
+        constexpr member() noexcept = default;
+
+        constexpr member(pointer begin, pointer end) noexcept
+            : span(begin, end),
+              unused(begin)
+        {
+        }
+
+        vista::span<node_type, Extent> span;
+        node_type *buckets[bucket_count] = {};
+        // Smallest element and its key of each bucket
+        node_type *smallest[bucket_count] = {};
+        key_type smallest_key[bucket_count] = {};
+        // Bit (index - 1) is set if bucket index is non-empty
+        std::uint64_t occupied = 0;
+        // Removed nodes
+        node_type *spare = nullptr;
+        // Nodes that have never been used
+        node_type *unused = nullptr;
+        size_type size = 0;
+        key_type last = 0;
+    } member;
+};
+
+template <typename Key, typename T, std::size_t Extent>
+constexpr std::size_t radix_priority_view<Key, T, Extent>::bucket_count;
+
+} // namespace vista
+
+#include <vista/detail/radix_priority_view.ipp>
+
+#endif // VISTA_RADIX_PRIORITY_VIEW_HPP
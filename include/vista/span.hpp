@@ -12,11 +12,47 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cstddef>
+#include <iterator>
 #include <vista/detail/config.hpp>
+#include <vista/detail/memory.hpp>
 #include <vista/detail/type_traits.hpp>
 
 namespace vista
 {
+namespace detail
+{
+
+// Size or stride that is a compile-time constant unless it is dynamic_extent.
+// The Tag distinguishes multiple instances used as empty base classes.
+
+template <std::size_t N, int Tag>
+struct extent_storage
+{
+    constexpr extent_storage(std::size_t) noexcept {}
+
+    static constexpr std::size_t value() noexcept { return N; }
+};
+
+template <int Tag>
+struct extent_storage<dynamic_extent, Tag>
+{
+    constexpr extent_storage(std::size_t value) noexcept : stored(value) {}
+
+    constexpr std::size_t value() const noexcept { return stored; }
+
+    std::size_t stored;
+};
+
+// Largest power of two that divides the byte offset, limited by alignment.
+
+constexpr std::size_t offset_alignment(std::size_t alignment, std::size_t offset) noexcept
+{
+    return (offset == 0 || (offset & (~offset + 1)) > alignment)
+        ? alignment
+        : (offset & (~offset + 1));
+}
+
+} // namespace detail
 
 //! @brief Span.
 //!
@@ -252,6 +288,629 @@ private:
     struct member_storage<T, Extent> member;
 };
 
+//! @brief Strided span.
+//!
+//! A span where consecutive elements are separated by a stride, such as a
+//! column in a row-major matrix or a channel in interleaved samples. Element
+//! at position @c p is located at data()[p * stride()].
+//!
+//! Extent is the number of elements and Stride is the distance between
+//! consecutive elements. Each of them is a compile-time constant unless it is
+//! dynamic_extent, in which case it is stored in the span.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <typename T,
+          std::size_t Extent = dynamic_extent,
+          std::size_t Stride = dynamic_extent>
+class strided_span
+{
+    static_assert(detail::is_complete<T>::value, "T must be complete");
+    static_assert(std::is_object<T>::value, "T must be an object");
+    static_assert(!std::is_abstract<T>::value, "T must not be an abstract class");
+    static_assert(Stride != 0, "Stride must be greater than zero");
+
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<element_type>::type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::add_pointer<element_type>::type;
+    using const_pointer = typename std::add_pointer<typename std::add_const<element_type>::type>::type;
+    using reference = typename std::add_lvalue_reference<element_type>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<element_type>::type>::type;
+
+private:
+    template <typename, std::size_t, std::size_t>
+    friend class strided_span;
+
+    template <typename U>
+    struct basic_iterator
+    {
+        using iterator_category = std::random_access_iterator_tag;
+        using element_type = U;
+        using value_type = typename std::remove_cv<element_type>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::add_pointer<element_type>::type;
+        using reference = typename std::add_lvalue_reference<element_type>::type;
+        using iterator_type = basic_iterator<U>;
+
+        constexpr basic_iterator() noexcept = default;
+        constexpr basic_iterator(const basic_iterator&) noexcept = default;
+        constexpr basic_iterator(basic_iterator&&) noexcept = default;
+        VISTA_CXX14_CONSTEXPR
+        basic_iterator& operator=(const basic_iterator&) noexcept = default;
+        VISTA_CXX14_CONSTEXPR
+        basic_iterator& operator=(basic_iterator&&) noexcept = default;
+
+        // iterator is convertible to const_iterator
+        template <typename ConstU = U,
+                  typename std::enable_if<std::is_const<ConstU>::value, int>::type = 0>
+        constexpr basic_iterator(const basic_iterator<typename std::remove_const<ConstU>::type>& other) noexcept
+            : member(other.member.head, other.member.index, other.stride())
+        {}
+
+        VISTA_CXX14_CONSTEXPR
+        iterator_type& operator++() noexcept;
+        VISTA_CXX14_CONSTEXPR
+        iterator_type operator++(int) noexcept;
+        VISTA_CXX14_CONSTEXPR
+        iterator_type& operator--() noexcept;
+        VISTA_CXX14_CONSTEXPR
+        iterator_type operator--(int) noexcept;
+
+        VISTA_CXX14_CONSTEXPR
+        iterator_type& operator+=(difference_type) noexcept;
+
+        constexpr iterator_type operator+(difference_type) const noexcept;
+
+        friend constexpr iterator_type operator+(difference_type amount,
+                                                 const iterator_type& other) noexcept
+        {
+            return other + amount;
+        }
+
+        VISTA_CXX14_CONSTEXPR
+        iterator_type& operator-=(difference_type) noexcept;
+
+        constexpr iterator_type operator-(difference_type) const noexcept;
+
+        constexpr difference_type operator-(const iterator_type&) const noexcept;
+
+        constexpr reference operator[](difference_type) const noexcept;
+
+        constexpr pointer operator->() const noexcept;
+        constexpr reference operator*() const noexcept;
+
+        constexpr bool operator==(const iterator_type&) const noexcept;
+        constexpr bool operator!=(const iterator_type&) const noexcept;
+        constexpr bool operator<(const iterator_type&) const noexcept;
+        constexpr bool operator<=(const iterator_type&) const noexcept;
+        constexpr bool operator>(const iterator_type&) const noexcept;
+        constexpr bool operator>=(const iterator_type&) const noexcept;
+
+    private:
+        template <typename, std::size_t, std::size_t>
+        friend class strided_span;
+
+        constexpr basic_iterator(pointer head, difference_type index, size_type stride) noexcept;
+
+        constexpr size_type stride() const noexcept;
+
+    private:
+        // Position is kept as an index to avoid forming pointers beyond the
+        // end of the underlying storage.
+        struct member_storage : detail::extent_storage<Stride, 0>
+        {
+            constexpr member_storage() noexcept
+                : detail::extent_storage<Stride, 0>(1),
+                  head(nullptr),
+                  index(0)
+            {}
+
+            constexpr member_storage(pointer head, difference_type index, size_type stride) noexcept
+                : detail::extent_storage<Stride, 0>(stride),
+                  head(head),
+                  index(index)
+            {}
+
+            pointer head;
+            difference_type index;
+        } member;
+    };
+
+public:
+    //! @brief Random access iterator.
+    //!
+    //! Type that models the RandomAccessIterator requirements.
+
+    using iterator = basic_iterator<element_type>;
+    using const_iterator = basic_iterator<typename std::add_const<element_type>::type>;
+
+    //! @brief Creates empty strided span.
+    //!
+    //! @pre Extent == 0 or Extent == dynamic_extent
+    //!
+    //! @post data() == nullptr
+    //! @post size() == 0
+
+    template <bool Constraint = (Extent == dynamic_extent || Extent == 0),
+              typename std::enable_if<Constraint, int>::type = 0>
+    constexpr strided_span() noexcept;
+
+    //! @brief Creates strided span by copying.
+
+    constexpr strided_span(const strided_span& other) = default;
+
+    //! @brief Creates strided span by copying.
+    //!
+    //! Enables copying mutable strided span to immutable strided span, and
+    //! fixed extent or stride to dynamic extent or stride.
+    //!
+    //! @pre Extent == OtherExtent or Extent == dynamic_extent
+    //! @pre Stride == OtherStride or Stride == dynamic_extent
+
+    template <typename OtherT,
+              std::size_t OtherExtent,
+              std::size_t OtherStride,
+              typename std::enable_if<(Extent == OtherExtent || Extent == dynamic_extent) && (Stride == OtherStride || Stride == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type = 0>
+    explicit constexpr strided_span(const strided_span<OtherT, OtherExtent, OtherStride>& other) noexcept;
+
+    //! @brief Creates strided span from contiguous span.
+    //!
+    //! @pre Extent == OtherExtent or Extent == dynamic_extent
+    //! @pre Stride == 1 or Stride == dynamic_extent
+    //!
+    //! @post stride() == 1
+
+    template <typename OtherT,
+              std::size_t OtherExtent,
+              typename std::enable_if<(Extent == OtherExtent || Extent == dynamic_extent) && (Stride == 1 || Stride == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type = 0>
+    explicit constexpr strided_span(span<OtherT, OtherExtent> other) noexcept;
+
+    //! @brief Creates strided span from pointer and size with fixed stride.
+    //!
+    //! @pre Stride != dynamic_extent
+    //! @pre Extent == size or Extent == dynamic_extent
+
+    template <bool Constraint = (Stride != dynamic_extent),
+              typename std::enable_if<Constraint, int>::type = 0>
+    constexpr strided_span(pointer data, size_type size) noexcept;
+
+    //! @brief Creates strided span from pointer, size, and stride.
+    //!
+    //! @pre Extent == size or Extent == dynamic_extent
+    //! @pre Stride == stride or Stride == dynamic_extent
+    //! @pre stride > 0
+
+    constexpr strided_span(pointer data, size_type size, size_type stride) noexcept;
+
+    //! @brief Recreates strided span by copying.
+
+    VISTA_CXX14_CONSTEXPR
+    strided_span& operator=(const strided_span& other) noexcept = default;
+
+    //! @brief Checks if strided span is empty.
+
+    constexpr bool empty() const noexcept;
+
+    //! @brief Returns the number of elements in strided span.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Returns the distance between consecutive elements.
+
+    constexpr size_type stride() const noexcept;
+
+    //! @brief Returns pointer to first element.
+
+    constexpr pointer data() const noexcept;
+
+    //! @brief Returns reference to first element in strided span.
+    //!
+    //! @pre size() > 0
+
+    constexpr reference front() const noexcept;
+
+    //! @brief Returns reference to last element in strided span.
+    //!
+    //! @pre size() > 0
+
+    constexpr reference back() const noexcept;
+
+    //! @brief Returns reference to element at position.
+    //!
+    //! @pre size() > position
+
+    constexpr reference operator[](size_type position) const noexcept;
+
+    //! @brief Returns a strided subspan.
+    //!
+    //! The subspan covers the elements from position Offset to position
+    //! Offset + Count with the same stride.
+    //!
+    //! @pre Offset <= size()
+    //! @pre Count == dynamic_extent or Count <= size() - Offset
+
+    template <std::size_t Offset, std::size_t Count = dynamic_extent>
+    constexpr strided_span<element_type, Count, Stride> subspan() const noexcept;
+
+    //! @brief Returns iterator to beginning of strided span.
+
+    constexpr iterator begin() const noexcept;
+
+    //! @brief Returns iterator to beginning of strided span.
+
+    constexpr const_iterator cbegin() const noexcept;
+
+    //! @brief Returns iterator to end of strided span.
+
+    constexpr iterator end() const noexcept;
+
+    //! @brief Returns iterator to end of strided span.
+
+    constexpr const_iterator cend() const noexcept;
+
+private:
+    struct member_storage
+        : detail::extent_storage<Extent, 0>,
+          detail::extent_storage<Stride, 1>
+    {
+        constexpr member_storage(pointer head, size_type size, size_type stride) noexcept
+            : detail::extent_storage<Extent, 0>(size),
+              detail::extent_storage<Stride, 1>(stride),
+              head(head)
+        {}
+
+        pointer head;
+    } member;
+};
+
+//! @brief Multidimensional span.
+//!
+//! A row-major matrix view over existing storage. Element (r, c) is located at
+//! data()[r * row_stride() + c].
+//!
+//! Rows and Columns are the extents, and RowStride is the distance between
+//! the beginning of consecutive rows, which defaults to Columns for densely
+//! packed matrices. Each of them is a compile-time constant unless it is
+//! dynamic_extent, in which case it is stored in the span.
+//!
+//! Rows are contiguous spans and columns are strided spans, so slicing a
+//! matrix span never copies elements.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <typename T,
+          std::size_t Rows = dynamic_extent,
+          std::size_t Columns = dynamic_extent,
+          std::size_t RowStride = Columns>
+class matrix_span
+{
+    static_assert(detail::is_complete<T>::value, "T must be complete");
+    static_assert(std::is_object<T>::value, "T must be an object");
+    static_assert(!std::is_abstract<T>::value, "T must not be an abstract class");
+    static_assert(Columns == dynamic_extent || RowStride == dynamic_extent || Columns <= RowStride, "RowStride must not be less than Columns");
+
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<element_type>::type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::add_pointer<element_type>::type;
+    using reference = typename std::add_lvalue_reference<element_type>::type;
+    using row_type = span<element_type, Columns>;
+    using column_type = strided_span<element_type, Rows, RowStride>;
+
+    //! @brief Creates matrix span from pointer with fixed extents.
+    //!
+    //! @pre Rows, Columns, and RowStride are not dynamic_extent
+
+    template <bool Constraint = (Rows != dynamic_extent && Columns != dynamic_extent && RowStride != dynamic_extent),
+              typename std::enable_if<Constraint, int>::type = 0>
+    explicit constexpr matrix_span(pointer data) noexcept;
+
+    //! @brief Creates matrix span from pointer and extents.
+    //!
+    //! The row stride is RowStride if fixed, and otherwise columns.
+    //!
+    //! @pre Rows == rows or Rows == dynamic_extent
+    //! @pre Columns == columns or Columns == dynamic_extent
+
+    constexpr matrix_span(pointer data, size_type rows, size_type columns) noexcept;
+
+    //! @brief Creates matrix span from pointer, extents, and row stride.
+    //!
+    //! @pre Rows == rows or Rows == dynamic_extent
+    //! @pre Columns == columns or Columns == dynamic_extent
+    //! @pre RowStride == row_stride or RowStride == dynamic_extent
+    //! @pre row_stride >= columns
+
+    constexpr matrix_span(pointer data, size_type rows, size_type columns, size_type row_stride) noexcept;
+
+    //! @brief Creates matrix span by copying.
+
+    constexpr matrix_span(const matrix_span& other) = default;
+
+    //! @brief Recreates matrix span by copying.
+
+    VISTA_CXX14_CONSTEXPR
+    matrix_span& operator=(const matrix_span& other) noexcept = default;
+
+    //! @brief Checks if matrix span is empty.
+
+    constexpr bool empty() const noexcept;
+
+    //! @brief Returns the number of elements in matrix span.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Returns the number of rows.
+
+    constexpr size_type rows() const noexcept;
+
+    //! @brief Returns the number of columns.
+
+    constexpr size_type columns() const noexcept;
+
+    //! @brief Returns the distance between the beginning of consecutive rows.
+
+    constexpr size_type row_stride() const noexcept;
+
+    //! @brief Returns pointer to first element.
+
+    constexpr pointer data() const noexcept;
+
+    //! @brief Returns reference to element at row and column.
+    //!
+    //! @pre row < rows()
+    //! @pre column < columns()
+
+    constexpr reference operator()(size_type row, size_type column) const noexcept;
+
+    //! @brief Returns contiguous span of row.
+    //!
+    //! @pre position < rows()
+
+    constexpr row_type row(size_type position) const noexcept;
+
+    //! @brief Returns strided span of column.
+    //!
+    //! @pre position < columns()
+
+    constexpr column_type column(size_type position) const noexcept;
+
+    //! @brief Returns a submatrix.
+    //!
+    //! The submatrix covers Count rows from RowOffset and ColumnCount
+    //! columns from ColumnOffset with the same row stride.
+    //!
+    //! @pre RowOffset <= rows()
+    //! @pre ColumnOffset <= columns()
+    //! @pre RowCount == dynamic_extent or RowCount <= rows() - RowOffset
+    //! @pre ColumnCount == dynamic_extent or ColumnCount <= columns() - ColumnOffset
+
+    template <std::size_t RowOffset,
+              std::size_t ColumnOffset,
+              std::size_t RowCount = dynamic_extent,
+              std::size_t ColumnCount = dynamic_extent>
+    constexpr matrix_span<element_type, RowCount, ColumnCount, RowStride> submatrix() const noexcept;
+
+    //! @brief Returns a submatrix.
+    //!
+    //! @pre row_offset + row_count <= rows()
+    //! @pre column_offset + column_count <= columns()
+
+    constexpr matrix_span<element_type, dynamic_extent, dynamic_extent, RowStride>
+    submatrix(size_type row_offset,
+              size_type column_offset,
+              size_type row_count,
+              size_type column_count) const noexcept;
+
+private:
+    struct member_storage
+        : detail::extent_storage<Rows, 0>,
+          detail::extent_storage<Columns, 1>,
+          detail::extent_storage<RowStride, 2>
+    {
+        constexpr member_storage(pointer head, size_type rows, size_type columns, size_type row_stride) noexcept
+            : detail::extent_storage<Rows, 0>(rows),
+              detail::extent_storage<Columns, 1>(columns),
+              detail::extent_storage<RowStride, 2>(row_stride),
+              head(head)
+        {}
+
+        pointer head;
+    } member;
+};
+
+//! @brief Aligned span.
+//!
+//! A contiguous span whose first element is guaranteed to be aligned to
+//! Alignment bytes. Element access informs the compiler about the alignment,
+//! so vectorized loops over the span can use aligned loads without peeling.
+//!
+//! The alignment is checked with assertions when the span is created from an
+//! unaligned type, and propagated without checks where it is provable.
+//!
+//! Aligned spans cannot be used in constant expressions.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <typename T,
+          std::size_t Extent = dynamic_extent,
+          std::size_t Alignment = alignof(T)>
+class aligned_span
+{
+    static_assert(detail::is_complete<T>::value, "T must be complete");
+    static_assert(std::is_object<T>::value, "T must be an object");
+    static_assert(!std::is_abstract<T>::value, "T must not be an abstract class");
+    static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must not be less than alignof(T)");
+
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<element_type>::type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::add_pointer<element_type>::type;
+    using reference = typename std::add_lvalue_reference<element_type>::type;
+    using iterator = pointer;
+    using const_iterator = typename std::add_pointer<typename std::add_const<element_type>::type>::type;
+
+    //! @brief Guaranteed alignment in bytes of the first element.
+
+    static constexpr size_type alignment = Alignment;
+
+    //! @brief Creates empty aligned span.
+    //!
+    //! @pre Extent == 0 or Extent == dynamic_extent
+    //!
+    //! @post data() == nullptr
+    //! @post size() == 0
+
+    template <bool Constraint = (Extent == dynamic_extent || Extent == 0),
+              typename std::enable_if<Constraint, int>::type = 0>
+    aligned_span() noexcept;
+
+    //! @brief Creates aligned span by copying.
+
+    aligned_span(const aligned_span& other) = default;
+
+    //! @brief Creates aligned span from aligned span with stricter alignment.
+    //!
+    //! @pre Extent == OtherExtent or Extent == dynamic_extent
+    //! @pre OtherAlignment >= Alignment
+
+    template <typename OtherT,
+              std::size_t OtherExtent,
+              std::size_t OtherAlignment,
+              typename std::enable_if<(Extent == OtherExtent || Extent == dynamic_extent) && (OtherAlignment >= Alignment) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type = 0>
+    aligned_span(const aligned_span<OtherT, OtherExtent, OtherAlignment>& other) noexcept;
+
+    //! @brief Creates aligned span from span with natural alignment.
+    //!
+    //! Any span, such as a segment of a circular view, is aligned to the
+    //! alignment of its element type.
+    //!
+    //! Only participates in overload resolution if Alignment <= alignof(OtherT).
+    //!
+    //! @pre Extent == OtherExtent or Extent == dynamic_extent
+
+    template <typename OtherT,
+              std::size_t OtherExtent,
+              typename std::enable_if<(Extent == OtherExtent || Extent == dynamic_extent) && (Alignment <= alignof(OtherT)) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type = 0>
+    aligned_span(span<OtherT, OtherExtent> other) noexcept;
+
+    //! @brief Creates aligned span from span.
+    //!
+    //! @pre Extent == OtherExtent or Extent == dynamic_extent
+    //! @pre other.data() is aligned to Alignment
+
+    template <typename OtherT,
+              std::size_t OtherExtent,
+              typename std::enable_if<(Extent == OtherExtent || Extent == dynamic_extent) && (Alignment > alignof(OtherT)) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type = 0>
+    explicit aligned_span(span<OtherT, OtherExtent> other) noexcept;
+
+    //! @brief Creates aligned span from pointer and size.
+    //!
+    //! @pre data is aligned to Alignment
+
+    aligned_span(pointer data, size_type size) noexcept;
+
+    //! @brief Creates aligned span from pointers.
+    //!
+    //! @pre first is aligned to Alignment
+
+    aligned_span(pointer first, pointer last) noexcept;
+
+    //! @brief Creates aligned span from array.
+    //!
+    //! @pre Extent == M or Extent == dynamic_extent
+    //! @pre array is aligned to Alignment
+
+    template <std::size_t M,
+              typename std::enable_if<(Extent == M || Extent == dynamic_extent), int>::type = 0>
+    explicit aligned_span(element_type (&array)[M]) noexcept;
+
+    //! @brief Recreates aligned span by copying.
+
+    aligned_span& operator=(const aligned_span& other) noexcept = default;
+
+    //! @brief Checks if aligned span is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Returns the number of elements in aligned span.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns aligned pointer to beginning of aligned span.
+
+    pointer data() const noexcept;
+
+    //! @brief Returns reference to first element in aligned span.
+    //!
+    //! @pre size() > 0
+
+    reference front() const noexcept;
+
+    //! @brief Returns reference to last element in aligned span.
+    //!
+    //! @pre size() > 0
+
+    reference back() const noexcept;
+
+    //! @brief Returns reference to element at position.
+    //!
+    //! @pre size() > position
+
+    reference operator[](difference_type position) const noexcept;
+
+    //! @brief Returns an aligned subspan.
+    //!
+    //! The subspan covers the range from data() + Offset to data() + Offset + Count.
+    //!
+    //! The alignment of the subspan is derived from the byte offset, so
+    //! offsets that are multiples of the alignment retain the alignment.
+    //!
+    //! @pre Offset <= size()
+    //! @pre Count == dynamic_extent or Count <= size() - Offset
+
+    template <std::size_t Offset, std::size_t Count = dynamic_extent>
+    aligned_span<element_type, Count, detail::offset_alignment(Alignment, Offset * sizeof(T))> subspan() const noexcept;
+
+    //! @brief Returns iterator to beginning of aligned span.
+
+    iterator begin() const noexcept;
+
+    //! @brief Returns iterator to beginning of aligned span.
+
+    const_iterator cbegin() const noexcept;
+
+    //! @brief Returns iterator to end of aligned span.
+
+    iterator end() const noexcept;
+
+    //! @brief Returns iterator to end of aligned span.
+
+    const_iterator cend() const noexcept;
+
+private:
+    struct member_storage : detail::extent_storage<Extent, 0>
+    {
+        member_storage(pointer head, size_type size) noexcept
+            : detail::extent_storage<Extent, 0>(size),
+              head(head)
+        {}
+
+        pointer head;
+    } member;
+};
+
+template <typename T, std::size_t Extent, std::size_t Alignment>
+constexpr std::size_t aligned_span<T, Extent, Alignment>::alignment;
+
 } // namespace vista
 
 #include <vista/detail/span.ipp>
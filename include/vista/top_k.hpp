@@ -0,0 +1,137 @@
+#ifndef VISTA_TOP_K_HPP
+#define VISTA_TOP_K_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <vista/functional.hpp> // less
+#include <vista/priority_view.hpp>
+#include <vista/span.hpp>
+
+namespace vista
+{
+
+//! @brief Fixed-capacity selection of the K largest elements.
+//!
+//! Keeps the K largest (by default) elements from a stream of elements.
+//!
+//! The elements are kept in a heap with the smallest of the kept elements at
+//! the top. That element is the threshold that new elements must exceed to be
+//! kept, so elements are rejected with a single comparison. An accepted
+//! element replaces the threshold with a single sift-down.
+//!
+//! The default ordering can be changed with a user-provided compare predicate.
+//!
+//! Violation of any precondition results in undefined behavior.
+
+template <typename T,
+          std::size_t K,
+          typename Compare = vista::less<T>>
+class top_k
+{
+    static_assert(K > 0, "K must be greater than zero");
+    static_assert(K != dynamic_extent, "K cannot be dynamic_extent");
+    static_assert(std::is_default_constructible<T>::value, "T must be DefaultConstructible");
+
+    // Reverses the order so the smallest kept element is at the top
+    struct reverse_compare
+    {
+        constexpr bool operator()(const T& lhs, const T& rhs) const noexcept(noexcept(std::declval<const Compare&>()(rhs, lhs)))
+        {
+            return compare(rhs, lhs);
+        }
+
+        Compare compare;
+    };
+
+    using view = priority_view<T, K, reverse_compare>;
+
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+    using segment = span<value_type>;
+
+    //! @brief Creates empty top-K selection.
+    //!
+    //! @post capacity() == K
+    //! @post size() == 0
+
+    top_k() noexcept;
+
+    //! @brief Creates top-K selection by copying.
+
+    top_k(const top_k& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Recreates top-K selection by copying.
+
+    top_k& operator=(const top_k& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Checks if no elements are kept.
+
+    bool empty() const noexcept;
+
+    //! @brief Checks if K elements are kept.
+
+    bool full() const noexcept;
+
+    //! @brief Returns the number of kept elements.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns K.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Returns the smallest kept element.
+    //!
+    //! When full, new elements must be larger than the threshold to be kept.
+    //!
+    //! @pre !empty()
+
+    const value_type& threshold() const noexcept;
+
+    //! @brief Offers element for selection.
+    //!
+    //! The element is kept if fewer than K elements are kept, or if the
+    //! element is larger than the threshold, in which case the threshold is
+    //! evicted.
+    //!
+    //! Returns true if the element is kept.
+
+    bool push(value_type input) noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Sorts the kept elements from largest to smallest.
+    //!
+    //! The elements are sorted in place with heap sort and returned as a
+    //! contiguous segment. The selection is emptied, and the segment remains
+    //! valid until the next element is pushed.
+    //!
+    //! @post empty()
+
+    segment sort() noexcept(std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes all kept elements.
+    //!
+    //! @post empty()
+
+    void clear() noexcept;
+
+private:
+    std::array<value_type, K> storage;
+    view heap;
+};
+
+} // namespace vista
+
+#include <vista/detail/top_k.ipp>
+
+#endif // VISTA_TOP_K_HPP
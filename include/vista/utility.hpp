@@ -64,7 +64,7 @@ constexpr bool operator==(const pair<T1, T2>& lhs,
 
 #if __cpp_lib_constexpr_utility >= 201811L
 
-using std::get
+using std::get;
 
 #else
 
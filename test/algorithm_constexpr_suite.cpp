@@ -141,6 +141,31 @@ static_assert(increasing_appended[3] == 11, "");
 static_assert(increasing_appended[4] == 33, "");
 static_assert(increasing_appended[5] == 22, "");
 
+//-----------------------------------------------------------------------------
+
+template <std::size_t N>
+constexpr auto make_sorted(vista::array<int, N> original)
+{
+    vista::make_heap<true>(original.begin(), original.end(), vista::less<int>{});
+    vista::sort_heap<true>(original.begin(), original.end(), vista::less<int>{});
+    return original;
+}
+
+constexpr vista::array<int, 5> unsorted = { 33, 11, 55, 22, 44 };
+
+static_assert(!vista::is_heap(unsorted.begin(), unsorted.end()), "");
+
+constexpr auto sorted = make_sorted(unsorted);
+
+static_assert(sorted[0] == 11, "");
+static_assert(sorted[1] == 22, "");
+static_assert(sorted[2] == 33, "");
+static_assert(sorted[3] == 44, "");
+static_assert(sorted[4] == 55, "");
+
+static_assert(vista::is_heap(increasing.begin(), increasing.end()), "");
+static_assert(vista::is_heap_until(increasing_appended.begin(), increasing_appended.end()) == increasing_appended.end(), "");
+
 } // namespace heap_suite
 
 //-----------------------------------------------------------------------------
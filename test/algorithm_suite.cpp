@@ -8,7 +8,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <boost/core/lightweight_test.hpp>
 #include <vista/algorithm.hpp>
 
@@ -964,6 +966,209 @@ void run()
 
 } // namespace pop_heap_suite
 
+//-----------------------------------------------------------------------------
+
+namespace arity_heap_suite
+{
+
+template <std::size_t Arity, typename T, std::size_t N>
+bool is_dary_heap(const std::array<T, N>& heap, std::size_t size)
+{
+    for (std::size_t k = 1; k < size; ++k)
+    {
+        if (heap[(k - 1) / Arity] < heap[k])
+            return false;
+    }
+    return true;
+}
+
+template <std::size_t Arity>
+void push_pop_sequence()
+{
+    // Linear congruential generator for reproducible input
+    std::uint32_t seed = 1;
+    std::array<int, 100> heap = {};
+    for (std::size_t k = 0; k < heap.size(); ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        heap[k] = int(seed >> 16) % 50;
+        vista::push_heap<false, Arity>(heap.begin(), heap.begin() + k + 1, std::less<int>{});
+        BOOST_TEST(is_dary_heap<Arity>(heap, k + 1));
+    }
+    for (std::size_t size = heap.size(); size > 1; --size)
+    {
+        vista::pop_heap<false, Arity>(heap.begin(), heap.begin() + size, std::less<int>{});
+        BOOST_TEST(is_dary_heap<Arity>(heap, size - 1));
+        // Popped element is not smaller than any remaining element
+        BOOST_TEST(heap[0] <= heap[size - 1]);
+    }
+    // Repeated popping sorts the heap in ascending order
+    for (std::size_t k = 1; k < heap.size(); ++k)
+    {
+        BOOST_TEST(heap[k - 1] <= heap[k]);
+    }
+}
+
+void run()
+{
+    push_pop_sequence<2>();
+    push_pop_sequence<3>();
+    push_pop_sequence<4>();
+    push_pop_sequence<8>();
+}
+
+} // namespace arity_heap_suite
+
+//-----------------------------------------------------------------------------
+
+namespace make_heap_suite
+{
+
+void make_empty()
+{
+    std::array<int, 0> heap = {};
+    vista::make_heap(heap.begin(), heap.end());
+    BOOST_TEST(vista::is_heap(heap.begin(), heap.end()));
+}
+
+void make_increasing()
+{
+    std::array<int, 5> heap = { 11, 22, 33, 44, 55 };
+    vista::make_heap(heap.begin(), heap.end());
+    BOOST_TEST(vista::is_heap(heap.begin(), heap.end()));
+    BOOST_TEST(std::is_heap(heap.begin(), heap.end()));
+    BOOST_TEST_EQ(heap[0], 55);
+}
+
+void make_increasing_predicate()
+{
+    std::array<int, 5> heap = { 55, 44, 33, 22, 11 };
+    vista::make_heap(heap.begin(), heap.end(), std::greater<int>{});
+    BOOST_TEST(vista::is_heap(heap.begin(), heap.end(), std::greater<int>{}));
+    BOOST_TEST_EQ(heap[0], 11);
+}
+
+template <std::size_t Arity>
+void make_sequence()
+{
+    // Linear congruential generator for reproducible input
+    std::uint32_t seed = 1;
+    std::array<int, 100> heap = {};
+    for (std::size_t size = 0; size <= heap.size(); ++size)
+    {
+        for (std::size_t k = 0; k < size; ++k)
+        {
+            seed = seed * 1103515245U + 12345U;
+            heap[k] = int(seed >> 16) % 50;
+        }
+        vista::make_heap<false, Arity>(heap.begin(), heap.begin() + size, std::less<int>{});
+        BOOST_TEST((vista::is_heap<Arity>(heap.begin(), heap.begin() + size, std::less<int>{})));
+    }
+}
+
+void run()
+{
+    make_empty();
+    make_increasing();
+    make_increasing_predicate();
+    make_sequence<2>();
+    make_sequence<3>();
+    make_sequence<4>();
+    make_sequence<8>();
+}
+
+} // namespace make_heap_suite
+
+//-----------------------------------------------------------------------------
+
+namespace is_heap_suite
+{
+
+void is_heap_until_empty()
+{
+    std::array<int, 0> heap = {};
+    BOOST_TEST(vista::is_heap_until(heap.begin(), heap.end()) == heap.end());
+}
+
+void is_heap_until_binary()
+{
+    std::array<int, 5> heap = { 55, 44, 33, 22, 11 };
+    BOOST_TEST(vista::is_heap_until(heap.begin(), heap.end()) == heap.end());
+    heap[3] = 66;
+    BOOST_TEST(vista::is_heap_until(heap.begin(), heap.end()) == heap.begin() + 3);
+    BOOST_TEST(!vista::is_heap(heap.begin(), heap.end()));
+    BOOST_TEST(vista::is_heap_until(heap.begin(), heap.end()) == std::is_heap_until(heap.begin(), heap.end()));
+}
+
+void is_heap_until_predicate()
+{
+    std::array<int, 5> heap = { 11, 22, 33, 44, 55 };
+    BOOST_TEST(vista::is_heap(heap.begin(), heap.end(), std::greater<int>{}));
+    BOOST_TEST(vista::is_heap_until(heap.begin(), heap.end()) == heap.begin() + 1);
+}
+
+void is_heap_until_arity()
+{
+    // Children of the root are at positions 1, 2, and 3 in a ternary heap
+    std::array<int, 5> heap = { 55, 11, 22, 33, 44 };
+    BOOST_TEST((vista::is_heap_until<3>(heap.begin(), heap.end(), std::less<int>{}) == heap.begin() + 4));
+    BOOST_TEST((vista::is_heap<4>(heap.begin(), heap.end(), std::less<int>{})));
+}
+
+void run()
+{
+    is_heap_until_empty();
+    is_heap_until_binary();
+    is_heap_until_predicate();
+    is_heap_until_arity();
+}
+
+} // namespace is_heap_suite
+
+//-----------------------------------------------------------------------------
+
+namespace sort_heap_suite
+{
+
+void sort_increasing()
+{
+    std::array<int, 5> heap = { 22, 55, 11, 44, 33 };
+    vista::make_heap(heap.begin(), heap.end());
+    vista::sort_heap(heap.begin(), heap.end());
+    std::array<int, 5> expect = { 11, 22, 33, 44, 55 };
+    BOOST_TEST_ALL_EQ(heap.begin(), heap.end(),
+                      expect.begin(), expect.end());
+}
+
+void sort_increasing_predicate()
+{
+    std::array<int, 5> heap = { 22, 55, 11, 44, 33 };
+    vista::make_heap(heap.begin(), heap.end(), std::greater<int>{});
+    vista::sort_heap(heap.begin(), heap.end(), std::greater<int>{});
+    std::array<int, 5> expect = { 55, 44, 33, 22, 11 };
+    BOOST_TEST_ALL_EQ(heap.begin(), heap.end(),
+                      expect.begin(), expect.end());
+}
+
+void sort_arity()
+{
+    std::array<int, 8> heap = { 22, 55, 11, 44, 33, 88, 77, 66 };
+    vista::make_heap<false, 4>(heap.begin(), heap.end(), std::less<int>{});
+    vista::sort_heap<false, 4>(heap.begin(), heap.end(), std::less<int>{});
+    std::array<int, 8> expect = { 11, 22, 33, 44, 55, 66, 77, 88 };
+    BOOST_TEST_ALL_EQ(heap.begin(), heap.end(),
+                      expect.begin(), expect.end());
+}
+
+void run()
+{
+    sort_increasing();
+    sort_increasing_predicate();
+    sort_arity();
+}
+
+} // namespace sort_heap_suite
+
 //-----------------------------------------------------------------------------
 // Sorted algorithms
 //-----------------------------------------------------------------------------
@@ -1075,6 +1280,73 @@ void run()
 
 //-----------------------------------------------------------------------------
 
+namespace upper_bound_sorted_suite
+{
+
+void find_even()
+{
+    std::array<int, 4> storage = { 11, 22, 33, 44 };
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 10),
+                  storage.begin());
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 11),
+                  std::next(storage.begin(), 1));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 12),
+                  std::next(storage.begin(), 1));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 43),
+                  std::next(storage.begin(), 3));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 44),
+                  storage.end());
+}
+
+void find_even_predicate()
+{
+    std::array<int, 4> storage = { 44, 33, 22, 11 };
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 45, std::greater<int>{}),
+                  storage.begin());
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 44, std::greater<int>{}),
+                  std::next(storage.begin(), 1));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 11, std::greater<int>{}),
+                  storage.end());
+}
+
+void find_odd()
+{
+    std::array<int, 5> storage = { 11, 22, 33, 44, 55 };
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 10),
+                  storage.begin());
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 11),
+                  std::next(storage.begin(), 1));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 54),
+                  std::next(storage.begin(), 4));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 55),
+                  storage.end());
+}
+
+void find_duplicates()
+{
+    std::array<int, 6> storage = { 11, 22, 22, 22, 33, 33 };
+    BOOST_TEST_EQ(lower_bound_sorted(storage.begin(), storage.end(), 22),
+                  std::next(storage.begin(), 1));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 22),
+                  std::next(storage.begin(), 4));
+    BOOST_TEST_EQ(lower_bound_sorted(storage.begin(), storage.end(), 33),
+                  std::next(storage.begin(), 4));
+    BOOST_TEST_EQ(upper_bound_sorted(storage.begin(), storage.end(), 33),
+                  storage.end());
+}
+
+void run()
+{
+    find_even();
+    find_even_predicate();
+    find_odd();
+    find_duplicates();
+}
+
+} // namespace upper_bound_sorted_suite
+
+//-----------------------------------------------------------------------------
+
 namespace push_sorted_suite
 {
 
@@ -1504,8 +1776,13 @@ int main()
 {
     push_heap_suite::run();
     pop_heap_suite::run();
+    arity_heap_suite::run();
+    make_heap_suite::run();
+    is_heap_suite::run();
+    sort_heap_suite::run();
 
     lower_bound_sorted_suite::run();
+    upper_bound_sorted_suite::run();
     push_sorted_suite::run();
     pop_sorted_suite::run();
     insertion_sort_suite::run();
@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vista/circular_array.hpp>
+
+using namespace vista;
+
+//-----------------------------------------------------------------------------
+
+namespace insert_suite
+{
+
+// Moves leading elements
+constexpr int insert_front_half(int position)
+{
+    circular_array<int, 5> array;
+    array.push_back(11);
+    array.push_back(33);
+    array.push_back(44);
+    array.push_back(55);
+    array.insert(array.begin() + 1, 22);
+    return array[position];
+}
+
+static_assert(insert_front_half(0) == 11, "");
+static_assert(insert_front_half(1) == 22, "");
+static_assert(insert_front_half(2) == 33, "");
+static_assert(insert_front_half(3) == 44, "");
+static_assert(insert_front_half(4) == 55, "");
+
+// Moves trailing elements
+constexpr int insert_back_half(int position)
+{
+    circular_array<int, 5> array;
+    array.push_back(11);
+    array.push_back(22);
+    array.push_back(33);
+    array.push_back(55);
+    array.insert(array.begin() + 3, 44);
+    return array[position];
+}
+
+static_assert(insert_back_half(0) == 11, "");
+static_assert(insert_back_half(1) == 22, "");
+static_assert(insert_back_half(2) == 33, "");
+static_assert(insert_back_half(3) == 44, "");
+static_assert(insert_back_half(4) == 55, "");
+
+// Moves elements across the wraparound
+constexpr int insert_wraparound(int position)
+{
+    circular_array<int, 4> array;
+    array.push_back(0);
+    array.push_back(0);
+    array.push_back(11);
+    array.push_back(22);
+    array.pop_front();
+    array.pop_front();
+    array.push_back(44);
+    array.insert(array.begin() + 2, 33);
+    return array[position];
+}
+
+static_assert(insert_wraparound(0) == 11, "");
+static_assert(insert_wraparound(1) == 22, "");
+static_assert(insert_wraparound(2) == 33, "");
+static_assert(insert_wraparound(3) == 44, "");
+
+} // namespace insert_suite
+
+//-----------------------------------------------------------------------------
+
+namespace erase_suite
+{
+
+constexpr int erase_front_half(int position)
+{
+    circular_array<int, 5> array;
+    array.push_back(11);
+    array.push_back(99);
+    array.push_back(22);
+    array.push_back(33);
+    array.push_back(44);
+    array.erase(array.begin() + 1);
+    return array[position];
+}
+
+static_assert(erase_front_half(0) == 11, "");
+static_assert(erase_front_half(1) == 22, "");
+static_assert(erase_front_half(2) == 33, "");
+static_assert(erase_front_half(3) == 44, "");
+
+constexpr int erase_back_half(int position)
+{
+    circular_array<int, 5> array;
+    array.push_back(11);
+    array.push_back(22);
+    array.push_back(33);
+    array.push_back(99);
+    array.push_back(44);
+    array.erase(array.begin() + 3);
+    return array[position];
+}
+
+static_assert(erase_back_half(0) == 11, "");
+static_assert(erase_back_half(1) == 22, "");
+static_assert(erase_back_half(2) == 33, "");
+static_assert(erase_back_half(3) == 44, "");
+
+constexpr int erase_range(int position)
+{
+    circular_array<int, 6> array;
+    array.push_back(11);
+    array.push_back(22);
+    array.push_back(98);
+    array.push_back(99);
+    array.push_back(33);
+    array.push_back(44);
+    array.erase(array.begin() + 2, array.begin() + 4);
+    return array[position];
+}
+
+static_assert(erase_range(0) == 11, "");
+static_assert(erase_range(1) == 22, "");
+static_assert(erase_range(2) == 33, "");
+static_assert(erase_range(3) == 44, "");
+
+constexpr std::size_t erase_range_size()
+{
+    circular_array<int, 6> array;
+    array.push_back(11);
+    array.push_back(22);
+    array.push_back(33);
+    array.erase(array.begin(), array.begin() + 2);
+    return array.size();
+}
+
+static_assert(erase_range_size() == 1, "");
+
+} // namespace erase_suite
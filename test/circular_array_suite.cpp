@@ -295,6 +295,52 @@ void api_remove_back_n()
     BOOST_TEST_EQ(data.size(), 0);
 }
 
+void api_insert()
+{
+    circular_array<int, 4> data;
+    data = { 11, 33 };
+    data.insert(data.begin() + 1, 22);
+    {
+        std::vector<int> expect = { 11, 22, 33 };
+        BOOST_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_erase()
+{
+    circular_array<int, 4> data;
+    data = { 11, 22, 33, 44 };
+    data.erase(data.begin() + 1);
+    {
+        std::vector<int> expect = { 11, 33, 44 };
+        BOOST_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+    data.erase(data.begin(), data.begin() + 2);
+    {
+        std::vector<int> expect = { 44 };
+        BOOST_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_evictor()
+{
+    circular_array<int, 2, counting_evictor> data;
+    data.push_back(11);
+    data.push_back(22);
+    data.push_back(33);
+    BOOST_TEST_EQ(data.evictor().count, 1);
+    circular_array<int, 2, counting_evictor> copy(data);
+    BOOST_TEST_EQ(copy.evictor().count, 1);
+    circular_array<int, 2, reject_evictor> rejecting;
+    BOOST_TEST(rejecting.push_back(11));
+    BOOST_TEST(rejecting.push_back(22));
+    BOOST_TEST(!rejecting.push_back(33));
+    BOOST_TEST_EQ(rejecting.back(), 22);
+}
+
 void api_begin_end()
 {
     circular_array<int, 4> data;
@@ -377,6 +423,9 @@ void run()
     api_expand_back_n();
     api_remove_back();
     api_remove_back_n();
+    api_insert();
+    api_erase();
+    api_evictor();
 
     api_begin_end();
     api_cbegin_cend();
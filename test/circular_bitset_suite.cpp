@@ -0,0 +1,321 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <deque>
+#include <boost/detail/lightweight_test.hpp>
+#include <vista/circular_bitset.hpp>
+
+using namespace vista;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_ctor_default()
+{
+    circular_bitset<4> data;
+    BOOST_TEST(data.empty());
+    BOOST_TEST(!data.full());
+    BOOST_TEST_EQ(data.size(), 0);
+    BOOST_TEST_EQ(data.capacity(), 4);
+    BOOST_TEST_EQ(data.count(), 0);
+}
+
+void api_word_count()
+{
+    BOOST_TEST_EQ(circular_bitset<1>::word_count, 1);
+    BOOST_TEST_EQ(circular_bitset<64>::word_count, 1);
+    BOOST_TEST_EQ(circular_bitset<65>::word_count, 2);
+    BOOST_TEST_EQ(circular_bitset<1024>::word_count, 16);
+}
+
+void api_full()
+{
+    circular_bitset<4> data;
+    data.push_back(true);
+    data.push_back(false);
+    data.push_back(true);
+    BOOST_TEST(!data.full());
+    data.push_back(false);
+    BOOST_TEST(data.full());
+}
+
+void api_front_back()
+{
+    circular_bitset<4> data;
+    data.push_back(true);
+    BOOST_TEST_EQ(data.front(), true);
+    BOOST_TEST_EQ(data.back(), true);
+    data.push_back(false);
+    BOOST_TEST_EQ(data.front(), true);
+    BOOST_TEST_EQ(data.back(), false);
+}
+
+void api_set()
+{
+    circular_bitset<4> data;
+    data.push_back(false);
+    data.push_back(false);
+    data.set(1);
+    BOOST_TEST_EQ(data[0], false);
+    BOOST_TEST_EQ(data[1], true);
+    BOOST_TEST_EQ(data.count(), 1);
+    data.set(1, false);
+    BOOST_TEST_EQ(data[1], false);
+    BOOST_TEST_EQ(data.count(), 0);
+}
+
+void api_clear()
+{
+    circular_bitset<4> data;
+    data.push_back(true);
+    data.push_back(true);
+    data.clear();
+    BOOST_TEST(data.empty());
+    BOOST_TEST_EQ(data.count(), 0);
+    BOOST_TEST_EQ(data.words()[0], 0);
+}
+
+void run()
+{
+    api_ctor_default();
+    api_word_count();
+    api_full();
+    api_front_back();
+    api_set();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace push_suite
+{
+
+void push_back_overwrite()
+{
+    circular_bitset<3> data;
+    data.push_back(true);
+    data.push_back(false);
+    data.push_back(true);
+    BOOST_TEST_EQ(data.count(), 2);
+    data.push_back(false);
+    BOOST_TEST_EQ(data.size(), 3);
+    BOOST_TEST_EQ(data[0], false);
+    BOOST_TEST_EQ(data[1], true);
+    BOOST_TEST_EQ(data[2], false);
+    BOOST_TEST_EQ(data.count(), 1);
+}
+
+void push_front_overwrite()
+{
+    circular_bitset<3> data;
+    data.push_front(true);
+    data.push_front(false);
+    data.push_front(true);
+    BOOST_TEST_EQ(data.count(), 2);
+    data.push_front(false);
+    BOOST_TEST_EQ(data.size(), 3);
+    BOOST_TEST_EQ(data[0], false);
+    BOOST_TEST_EQ(data[1], true);
+    BOOST_TEST_EQ(data[2], false);
+    BOOST_TEST_EQ(data.count(), 1);
+}
+
+void push_back_word()
+{
+    circular_bitset<8> data;
+    data.push_back(0x0DU, 4); // 1, 0, 1, 1
+    BOOST_TEST_EQ(data.size(), 4);
+    BOOST_TEST_EQ(data[0], true);
+    BOOST_TEST_EQ(data[1], false);
+    BOOST_TEST_EQ(data[2], true);
+    BOOST_TEST_EQ(data[3], true);
+    BOOST_TEST_EQ(data.count(), 3);
+    // Upper bits beyond count are ignored
+    data.push_back(0xF1U, 6); // 1, 0, 0, 0, 1, 1
+    BOOST_TEST_EQ(data.size(), 8);
+    BOOST_TEST_EQ(data[0], true);
+    BOOST_TEST_EQ(data[1], true);
+    BOOST_TEST_EQ(data[2], true);
+    BOOST_TEST_EQ(data[3], false);
+    BOOST_TEST_EQ(data[4], false);
+    BOOST_TEST_EQ(data[5], false);
+    BOOST_TEST_EQ(data[6], true);
+    BOOST_TEST_EQ(data[7], true);
+    BOOST_TEST_EQ(data.count(), 5);
+}
+
+void push_back_full_word()
+{
+    circular_bitset<100> data;
+    data.push_back(true);
+    data.push_back(~std::uint64_t(0), 64);
+    data.push_back(~std::uint64_t(0), 64);
+    BOOST_TEST(data.full());
+    BOOST_TEST_EQ(data.count(), 100);
+    data.push_back(0, 64);
+    BOOST_TEST_EQ(data.count(), 36);
+    BOOST_TEST_EQ(data.count_back(64), 0);
+    BOOST_TEST_EQ(data.count_back(65), 1);
+}
+
+void run()
+{
+    push_back_overwrite();
+    push_front_overwrite();
+    push_back_word();
+    push_back_full_word();
+}
+
+} // namespace push_suite
+
+//-----------------------------------------------------------------------------
+
+namespace pop_suite
+{
+
+void pop_front()
+{
+    circular_bitset<4> data;
+    data.push_back(true);
+    data.push_back(false);
+    BOOST_TEST_EQ(data.pop_front(), true);
+    BOOST_TEST_EQ(data.count(), 0);
+    BOOST_TEST_EQ(data.pop_front(), false);
+    BOOST_TEST(data.empty());
+}
+
+void pop_back()
+{
+    circular_bitset<4> data;
+    data.push_back(false);
+    data.push_back(true);
+    BOOST_TEST_EQ(data.pop_back(), true);
+    BOOST_TEST_EQ(data.count(), 0);
+    BOOST_TEST_EQ(data.pop_back(), false);
+    BOOST_TEST(data.empty());
+}
+
+void remove_front_wraparound()
+{
+    circular_bitset<70> data;
+    for (int k = 0; k < 100; ++k)
+    {
+        data.push_back(true);
+    }
+    BOOST_TEST_EQ(data.count(), 70);
+    data.remove_front(50);
+    BOOST_TEST_EQ(data.size(), 20);
+    BOOST_TEST_EQ(data.count(), 20);
+    data.remove_back(5);
+    BOOST_TEST_EQ(data.size(), 15);
+    BOOST_TEST_EQ(data.count(), 15);
+}
+
+void run()
+{
+    pop_front();
+    pop_back();
+    remove_front_wraparound();
+}
+
+} // namespace pop_suite
+
+//-----------------------------------------------------------------------------
+
+namespace count_suite
+{
+
+void count_back()
+{
+    circular_bitset<8> data;
+    data.push_back(true);
+    data.push_back(true);
+    data.push_back(false);
+    data.push_back(true);
+    BOOST_TEST_EQ(data.count_back(0), 0);
+    BOOST_TEST_EQ(data.count_back(1), 1);
+    BOOST_TEST_EQ(data.count_back(2), 1);
+    BOOST_TEST_EQ(data.count_back(3), 2);
+    BOOST_TEST_EQ(data.count_back(4), 3);
+}
+
+void count_against_deque()
+{
+    // Linear congruential generator for reproducible bit patterns
+    std::uint32_t seed = 1;
+    circular_bitset<130> data;
+    std::deque<bool> expect;
+    for (int k = 0; k < 1000; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        const bool value = (seed >> 16) & 1U;
+        switch ((seed >> 20) % 4)
+        {
+        case 0:
+            data.push_front(value);
+            expect.push_front(value);
+            if (expect.size() > data.capacity())
+                expect.pop_back();
+            break;
+        case 1:
+            if (!expect.empty())
+            {
+                BOOST_TEST_EQ(data.pop_back(), expect.back());
+                expect.pop_back();
+            }
+            break;
+        default:
+            data.push_back(value);
+            expect.push_back(value);
+            if (expect.size() > data.capacity())
+                expect.pop_front();
+            break;
+        }
+        BOOST_TEST_EQ(data.size(), expect.size());
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < expect.size(); ++i)
+        {
+            BOOST_TEST_EQ(data[i], expect[i]);
+            total += expect[i];
+        }
+        BOOST_TEST_EQ(data.count(), total);
+        const auto length = expect.size() / 3;
+        std::size_t partial = 0;
+        for (std::size_t i = expect.size() - length; i < expect.size(); ++i)
+        {
+            partial += expect[i];
+        }
+        BOOST_TEST_EQ(data.count_back(length), partial);
+    }
+}
+
+void run()
+{
+    count_back();
+    count_against_deque();
+}
+
+} // namespace count_suite
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    push_suite::run();
+    pop_suite::run();
+    count_suite::run();
+
+    return boost::report_errors();
+}
@@ -11,6 +11,7 @@
 #include <array>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include <utility>
 #include <boost/detail/lightweight_test.hpp>
 #include <vista/circular_view.hpp>
@@ -458,6 +459,196 @@ void run()
 // main
 //-----------------------------------------------------------------------------
 
+namespace sorted_suite
+{
+
+void lower_bound_empty()
+{
+    int array[4] = {};
+    circular_view<int> span(array);
+    BOOST_TEST(lower_bound_sorted(span, 0) == span.end());
+    BOOST_TEST(upper_bound_sorted(span, 0) == span.end());
+}
+
+void lower_bound_wrapped()
+{
+    int array[8] = {};
+    circular_view<int> span(array);
+    // Rotate storage so that the view wraps around
+    for (int k = 0; k < 13; ++k)
+    {
+        span.push_back(k * 2);
+    }
+    BOOST_TEST_EQ(span.first_segment().size(), 3);
+    for (int needle = -1; needle < 30; ++needle)
+    {
+        BOOST_TEST(lower_bound_sorted(span, needle) == std::lower_bound(span.begin(), span.end(), needle));
+        BOOST_TEST(upper_bound_sorted(span, needle) == std::upper_bound(span.begin(), span.end(), needle));
+    }
+}
+
+void lower_bound_const()
+{
+    int array[5] = {};
+    circular_view<int> span(array);
+    span = { 11, 22, 33, 44, 55 };
+    span.push_back(66);
+    const auto& immutable = span;
+    BOOST_TEST(lower_bound_sorted(immutable, 22) == immutable.begin());
+    BOOST_TEST(lower_bound_sorted(immutable, 50) == immutable.begin() + 3);
+    BOOST_TEST(lower_bound_sorted(immutable, 66) == immutable.begin() + 4);
+    BOOST_TEST(lower_bound_sorted(immutable, 77) == immutable.end());
+}
+
+void lower_bound_predicate()
+{
+    int array[5] = {};
+    circular_view<int> span(array);
+    span = { 55, 44, 33, 22, 11 };
+    span.push_back(0);
+    span.push_back(-11);
+    auto where = lower_bound_sorted(span, 22, std::greater<int>{});
+    BOOST_TEST(where == span.begin() + 1);
+    where = upper_bound_sorted(span, 22, std::greater<int>{});
+    BOOST_TEST(where == span.begin() + 2);
+}
+
+void equal_range_duplicates()
+{
+    int array[8] = {};
+    circular_view<int> span(array);
+    for (int k = 0; k < 11; ++k)
+    {
+        span.push_back(k / 3);
+    }
+    for (int needle = -1; needle < 5; ++needle)
+    {
+        auto where = equal_range_sorted(span, needle);
+        auto expect = std::equal_range(span.begin(), span.end(), needle);
+        BOOST_TEST(where.first == expect.first);
+        BOOST_TEST(where.second == expect.second);
+    }
+}
+
+void run()
+{
+    lower_bound_empty();
+    lower_bound_wrapped();
+    lower_bound_const();
+    lower_bound_predicate();
+    equal_range_duplicates();
+}
+
+} // namespace sorted_suite
+
+//-----------------------------------------------------------------------------
+
+namespace erase_suite
+{
+
+bool is_odd(int value)
+{
+    return value % 2 != 0;
+}
+
+void erase_if_empty()
+{
+    int array[4] = {};
+    circular_view<int> span(array);
+    BOOST_TEST_EQ(erase_if(span, is_odd), 0);
+    BOOST_TEST(span.empty());
+}
+
+void erase_if_none()
+{
+    int array[4] = {};
+    circular_view<int> span(array);
+    span = { 2, 4, 6 };
+    BOOST_TEST_EQ(erase_if(span, is_odd), 0);
+    {
+        std::vector<int> expect = { 2, 4, 6 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_if_all()
+{
+    int array[4] = {};
+    circular_view<int> span(array);
+    span = { 1, 3, 5, 7 };
+    span.push_back(9);
+    BOOST_TEST_EQ(erase_if(span, is_odd), 4);
+    BOOST_TEST(span.empty());
+}
+
+void erase_if_wraparound()
+{
+    int array[6] = {};
+    circular_view<int> span(array);
+    for (int k = 1; k <= 10; ++k)
+    {
+        span.push_back(k);
+    }
+    // Storage is { 7, 8, 9, 10, 5, 6 }
+    BOOST_TEST_EQ(span.last_segment().size(), 4);
+    BOOST_TEST_EQ(erase_if(span, is_odd), 3);
+    {
+        std::vector<int> expect = { 6, 8, 10 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    span.push_back(12);
+    {
+        std::vector<int> expect = { 6, 8, 10, 12 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_if_against_vector()
+{
+    int array[7] = {};
+    circular_view<int> span(array);
+    for (int offset = 0; offset < 7; ++offset)
+    {
+        for (unsigned mask = 0; mask < (1U << 7); ++mask)
+        {
+            // Rotate storage so that the view wraps around at offset
+            span.clear();
+            if (offset > 0)
+            {
+                span.expand_back(offset);
+                span.remove_front(offset);
+            }
+            std::vector<int> expect;
+            for (int k = 0; k < 7; ++k)
+            {
+                span.push_back(k);
+                if (!((mask >> k) & 1U))
+                    expect.push_back(k);
+            }
+            const auto removed = erase_if(span, [mask](int value) { return (mask >> value) & 1U; });
+            BOOST_TEST_EQ(removed, 7 - expect.size());
+            BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                              expect.begin(), expect.end());
+        }
+    }
+}
+
+void run()
+{
+    erase_if_empty();
+    erase_if_none();
+    erase_if_all();
+    erase_if_wraparound();
+    erase_if_against_vector();
+}
+
+} // namespace erase_suite
+
+//-----------------------------------------------------------------------------
+
 int main()
 {
     copy_suite::run();
@@ -465,6 +656,8 @@ int main()
     fill_suite::run();
     find_suite::run();
     predicate_suite::run();
+    sorted_suite::run();
+    erase_suite::run();
 
     return boost::report_errors();
 }
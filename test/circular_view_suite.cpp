@@ -8,7 +8,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <deque>
+#include <ostream>
+#include <string>
 #include <vector>
 #include <boost/detail/lightweight_test.hpp>
 #include <vista/circular_view.hpp>
@@ -3870,6 +3875,398 @@ void run()
 // main
 //-----------------------------------------------------------------------------
 
+namespace insert_suite
+{
+
+void insert_empty()
+{
+    int array[4] = {};
+    circular_view<int> span(array);
+    auto where = span.insert(span.begin(), 11);
+    BOOST_TEST(where == span.begin());
+    {
+        std::vector<int> expect = { 11 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_front_side()
+{
+    int array[5] = {};
+    circular_view<int> span(array);
+    span = { 11, 22, 33, 44 };
+    auto where = span.insert(span.begin() + 1, 15);
+    BOOST_TEST_EQ(*where, 15);
+    BOOST_TEST(where == span.begin() + 1);
+    {
+        std::vector<int> expect = { 11, 15, 22, 33, 44 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_back_side()
+{
+    int array[5] = {};
+    circular_view<int> span(array);
+    span = { 11, 22, 33, 44 };
+    auto where = span.insert(span.begin() + 3, 40);
+    BOOST_TEST_EQ(*where, 40);
+    {
+        std::vector<int> expect = { 11, 22, 33, 40, 44 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    span.remove_back();
+    where = span.insert(span.end(), 55);
+    BOOST_TEST(where == span.end() - 1);
+    {
+        std::vector<int> expect = { 11, 22, 33, 40, 55 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_wraparound()
+{
+    int array[6] = {};
+    circular_view<int> span(array);
+    span = { 0, 0, 0, 0, 11, 22 };
+    span.push_back(33);
+    span.push_back(44);
+    span.remove_front(2);
+    // Storage is { 33, 44, 0, 0, 11, 22 }
+    span.insert(span.begin() + 2, 30);
+    {
+        std::vector<int> expect = { 11, 22, 30, 33, 44 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_string()
+{
+    std::string array[4];
+    circular_view<std::string> span(array);
+    span.push_back("alpha");
+    span.push_back("gamma");
+    span.insert(span.begin() + 1, "beta");
+    span.insert(span.begin(), "omega");
+    {
+        std::vector<std::string> expect = { "omega", "alpha", "beta", "gamma" };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void run()
+{
+    insert_empty();
+    insert_front_side();
+    insert_back_side();
+    insert_wraparound();
+    insert_string();
+}
+
+} // namespace insert_suite
+
+//-----------------------------------------------------------------------------
+
+namespace erase_suite
+{
+
+void erase_front_side()
+{
+    int array[5] = {};
+    circular_view<int> span(array);
+    span = { 11, 22, 33, 44, 55 };
+    auto where = span.erase(span.begin() + 1);
+    BOOST_TEST_EQ(*where, 33);
+    BOOST_TEST(where == span.begin() + 1);
+    {
+        std::vector<int> expect = { 11, 33, 44, 55 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_back_side()
+{
+    int array[5] = {};
+    circular_view<int> span(array);
+    span = { 11, 22, 33, 44, 55 };
+    auto where = span.erase(span.begin() + 3);
+    BOOST_TEST_EQ(*where, 55);
+    {
+        std::vector<int> expect = { 11, 22, 33, 55 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    where = span.erase(span.end() - 1);
+    BOOST_TEST(where == span.end());
+    {
+        std::vector<int> expect = { 11, 22, 33 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_range()
+{
+    int array[6] = {};
+    circular_view<int> span(array);
+    span = { 11, 22, 33, 44, 55, 66 };
+    auto where = span.erase(span.begin() + 1, span.begin() + 3);
+    BOOST_TEST_EQ(*where, 44);
+    {
+        std::vector<int> expect = { 11, 44, 55, 66 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    where = span.erase(span.begin() + 2, span.begin() + 2);
+    BOOST_TEST_EQ(*where, 55);
+    BOOST_TEST_EQ(span.size(), 4);
+    where = span.erase(span.begin(), span.end());
+    BOOST_TEST(where == span.end());
+    BOOST_TEST(span.empty());
+}
+
+void erase_string()
+{
+    std::string array[4];
+    circular_view<std::string> span(array);
+    span = { "alpha", "beta", "gamma", "delta" };
+    span.erase(span.begin() + 2);
+    span.erase(span.begin() + 1);
+    {
+        std::vector<std::string> expect = { "alpha", "delta" };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+template <typename T>
+void insert_erase_against_deque()
+{
+    // Linear congruential generator for reproducible operations
+    std::uint32_t seed = 1;
+    T array[11] = {};
+    circular_view<T> span(array);
+    std::deque<T> expect;
+    for (int k = 0; k < 2000; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        const auto random = seed >> 8;
+        const auto position = expect.empty() ? 0 : random % (expect.size() + 1);
+        if (random % 3 == 0 && !span.full())
+        {
+            const T value = T(k);
+            span.insert(span.begin() + position, value);
+            expect.insert(expect.begin() + position, value);
+        }
+        else if (random % 3 == 1 && position < expect.size())
+        {
+            const auto count = std::min<std::size_t>((random >> 4) % 4, expect.size() - position);
+            span.erase(span.begin() + position, span.begin() + position + count);
+            expect.erase(expect.begin() + position, expect.begin() + position + count);
+        }
+        else
+        {
+            span.push_back(T(k));
+            expect.push_back(T(k));
+            if (expect.size() > span.capacity())
+                expect.pop_front();
+        }
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+struct movable
+{
+    movable(int value = 0) : value(value) {}
+    movable(const movable&) = default;
+    movable& operator=(const movable& other) { value = other.value; return *this; }
+    bool operator==(const movable& other) const { return value == other.value; }
+    bool operator!=(const movable& other) const { return value != other.value; }
+    friend std::ostream& operator<<(std::ostream& stream, const movable& self) { return stream << self.value; }
+
+    int value;
+};
+
+void run()
+{
+    erase_front_side();
+    erase_back_side();
+    erase_range();
+    erase_string();
+    insert_erase_against_deque<int>();
+    insert_erase_against_deque<movable>();
+}
+
+} // namespace erase_suite
+
+//-----------------------------------------------------------------------------
+
+namespace evict_suite
+{
+
+void evict_overwrite()
+{
+    int array[2] = {};
+    circular_view<int> span(array);
+    BOOST_TEST(span.push_back(11));
+    BOOST_TEST(span.push_back(22));
+    BOOST_TEST(span.push_back(33));
+    {
+        std::vector<int> expect = { 22, 33 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    BOOST_TEST(span.push_front(11));
+    {
+        std::vector<int> expect = { 11, 22 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_reject()
+{
+    int array[2] = {};
+    circular_view<int, dynamic_extent, reject_evictor> span(array);
+    BOOST_TEST(span.push_back(11));
+    BOOST_TEST(span.push_back(22));
+    BOOST_TEST(!span.push_back(33));
+    BOOST_TEST(!span.push_front(0));
+    {
+        std::vector<int> expect = { 11, 22 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    span.remove_front();
+    BOOST_TEST(span.push_back(33));
+    {
+        std::vector<int> expect = { 22, 33 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_reject_range()
+{
+    int array[3] = {};
+    circular_view<int, 3, reject_evictor> span(array);
+    std::vector<int> input = { 11, 22, 33, 44, 55 };
+    BOOST_TEST_EQ(span.push_back(input.begin(), input.end()), 3);
+    {
+        std::vector<int> expect = { 11, 22, 33 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    BOOST_TEST_EQ(span.push_front(input.begin(), input.end()), 0);
+    span.remove_back(2);
+    BOOST_TEST_EQ(span.push_front(input.begin(), input.end()), 2);
+    {
+        std::vector<int> expect = { 22, 11, 11 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    BOOST_TEST_EQ(span.assign(input.begin(), input.begin() + 2), 2);
+    BOOST_TEST_EQ(span.size(), 2);
+    BOOST_TEST_EQ(span.assign({ 1, 2, 3, 4 }), 3);
+    {
+        std::vector<int> expect = { 1, 2, 3 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_overwrite_range()
+{
+    int array[3] = {};
+    circular_view<int> span(array);
+    std::vector<int> input = { 11, 22, 33, 44, 55 };
+    // Overwritten elements were inserted before being overwritten
+    BOOST_TEST_EQ(span.push_back(input.begin(), input.end()), 5);
+    BOOST_TEST_EQ(span.push_front(input.begin(), input.end()), 5);
+    BOOST_TEST_EQ(span.assign({ 1, 2, 3, 4 }), 4);
+    BOOST_TEST_EQ(span.size(), 3);
+}
+
+void evict_counting()
+{
+    int array[2] = {};
+    circular_view<int, dynamic_extent, counting_evictor> span(array);
+    span.push_back(11);
+    span.push_back(22);
+    BOOST_TEST_EQ(span.evictor().count, 0);
+    span.push_back(33);
+    span.push_front(44);
+    BOOST_TEST_EQ(span.evictor().count, 2);
+    span = { 1, 2, 3, 4, 5 };
+    BOOST_TEST_EQ(span.evictor().count, 5);
+}
+
+struct spill_evictor
+{
+    bool operator()(int& evicted)
+    {
+        spilled->push_back(evicted);
+        return true;
+    }
+
+    std::vector<int> *spilled = nullptr;
+};
+
+void evict_callback()
+{
+    std::vector<int> spilled;
+    int array[3] = {};
+    circular_view<int, dynamic_extent, spill_evictor> span(array);
+    span.evictor().spilled = &spilled;
+    for (int k = 1; k <= 6; ++k)
+    {
+        span.push_back(k * 11);
+    }
+    {
+        std::vector<int> expect = { 44, 55, 66 };
+        BOOST_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 11, 22, 33 };
+        BOOST_TEST_ALL_EQ(spilled.begin(), spilled.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_copy()
+{
+    int array[1] = {};
+    circular_view<int, dynamic_extent, counting_evictor> span(array);
+    span.push_back(11);
+    span.push_back(22);
+    circular_view<const int, dynamic_extent, counting_evictor> copy(span);
+    BOOST_TEST_EQ(copy.evictor().count, 1);
+}
+
+void run()
+{
+    evict_overwrite();
+    evict_reject();
+    evict_reject_range();
+    evict_overwrite_range();
+    evict_counting();
+    evict_callback();
+    evict_copy();
+}
+
+} // namespace evict_suite
+
+//-----------------------------------------------------------------------------
+
 int main()
 {
     api_dynamic_suite::run();
@@ -3883,6 +4280,9 @@ int main()
     window_size_suite::run();
     expand_suite::run();
     normalize_suite::run();
+    insert_suite::run();
+    erase_suite::run();
+    evict_suite::run();
  
     return boost::report_errors();
 }
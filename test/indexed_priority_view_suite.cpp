@@ -0,0 +1,390 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <boost/detail/lightweight_test.hpp>
+#include <vista/indexed_priority_view.hpp>
+
+using namespace vista;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_ctor_default()
+{
+    indexed_priority_view<int> span;
+    BOOST_TEST(span.empty());
+    BOOST_TEST(span.full());
+    BOOST_TEST_EQ(span.size(), 0);
+    BOOST_TEST_EQ(span.capacity(), 0);
+}
+
+void api_ctor_array()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int, 4> span(values, indices);
+    BOOST_TEST(span.empty());
+    BOOST_TEST(!span.full());
+    BOOST_TEST_EQ(span.size(), 0);
+    BOOST_TEST_EQ(span.capacity(), 4);
+    BOOST_TEST(!span.contains(0));
+    BOOST_TEST(!span.contains(3));
+}
+
+void api_ctor_pointer()
+{
+    std::array<int, 4> values;
+    std::array<std::size_t, 8> indices;
+    indexed_priority_view<int> span(values.data(), indices.data(), values.size());
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(span.capacity(), 4);
+}
+
+void api_contains()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int> span(values, indices);
+    span.push(2, 22);
+    BOOST_TEST(!span.contains(0));
+    BOOST_TEST(!span.contains(1));
+    BOOST_TEST(span.contains(2));
+    BOOST_TEST_EQ(span[2], 22);
+    BOOST_TEST_EQ(values[2], 22);
+}
+
+void api_clear()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int> span(values, indices);
+    span.push(0, 11);
+    span.push(3, 33);
+    span.clear();
+    BOOST_TEST(span.empty());
+    BOOST_TEST(!span.contains(0));
+    BOOST_TEST(!span.contains(3));
+    span.push(3, 44);
+    BOOST_TEST_EQ(span.top_handle(), 3);
+}
+
+void run()
+{
+    api_ctor_default();
+    api_ctor_array();
+    api_ctor_pointer();
+    api_contains();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace push_suite
+{
+
+void push_pop()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int> span(values, indices);
+    span.push(0, 22);
+    span.push(1, 44);
+    span.push(2, 11);
+    span.push(3, 33);
+    BOOST_TEST(span.full());
+    BOOST_TEST_EQ(span.top(), 44);
+    BOOST_TEST_EQ(span.top_handle(), 1);
+    span.pop();
+    BOOST_TEST(!span.contains(1));
+    BOOST_TEST_EQ(span.top_handle(), 3);
+    span.pop();
+    BOOST_TEST_EQ(span.top_handle(), 0);
+    span.pop();
+    BOOST_TEST_EQ(span.top_handle(), 2);
+    span.pop();
+    BOOST_TEST(span.empty());
+}
+
+void push_pop_predicate()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int, 4, std::greater<int>> span(values, indices);
+    span.push(0, 22);
+    span.push(1, 44);
+    span.push(2, 11);
+    span.push(3, 33);
+    const std::size_t expect[] = { 2, 0, 3, 1 };
+    for (auto handle : expect)
+    {
+        BOOST_TEST_EQ(span.top_handle(), handle);
+        span.pop();
+    }
+}
+
+void run()
+{
+    push_pop();
+    push_pop_predicate();
+}
+
+} // namespace push_suite
+
+//-----------------------------------------------------------------------------
+
+namespace update_suite
+{
+
+void update_increase()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int> span(values, indices);
+    span.push(0, 22);
+    span.push(1, 44);
+    span.push(2, 11);
+    span.update(2, 55);
+    BOOST_TEST_EQ(span.top_handle(), 2);
+    BOOST_TEST_EQ(span.top(), 55);
+}
+
+void update_decrease()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int> span(values, indices);
+    span.push(0, 22);
+    span.push(1, 44);
+    span.push(2, 11);
+    span.update(1, 0);
+    BOOST_TEST_EQ(span.top_handle(), 0);
+    span.pop();
+    BOOST_TEST_EQ(span.top_handle(), 2);
+    span.pop();
+    BOOST_TEST_EQ(span.top_handle(), 1);
+    BOOST_TEST_EQ(span.top(), 0);
+}
+
+void erase_top()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int> span(values, indices);
+    span.push(0, 22);
+    span.push(1, 44);
+    span.erase(1);
+    BOOST_TEST_EQ(span.size(), 1);
+    BOOST_TEST(!span.contains(1));
+    BOOST_TEST_EQ(span.top_handle(), 0);
+}
+
+void erase_last()
+{
+    int values[4];
+    std::size_t indices[8];
+    indexed_priority_view<int> span(values, indices);
+    span.push(0, 22);
+    span.push(1, 11);
+    span.erase(1);
+    BOOST_TEST_EQ(span.size(), 1);
+    BOOST_TEST_EQ(span.top_handle(), 0);
+    span.push(1, 33);
+    BOOST_TEST_EQ(span.top_handle(), 1);
+}
+
+void erase_middle()
+{
+    int values[8];
+    std::size_t indices[16];
+    indexed_priority_view<int> span(values, indices);
+    for (int k = 0; k < 8; ++k)
+    {
+        span.push(k, k * 11);
+    }
+    span.erase(3);
+    span.erase(6);
+    const std::size_t expect[] = { 7, 5, 4, 2, 1, 0 };
+    for (auto handle : expect)
+    {
+        BOOST_TEST_EQ(span.top_handle(), handle);
+        span.pop();
+    }
+    BOOST_TEST(span.empty());
+}
+
+void run()
+{
+    update_increase();
+    update_decrease();
+    erase_top();
+    erase_last();
+    erase_middle();
+}
+
+} // namespace update_suite
+
+//-----------------------------------------------------------------------------
+
+namespace random_suite
+{
+
+// Compare against a linear scan of the handles
+
+template <std::size_t Arity>
+void random_operations()
+{
+    constexpr std::size_t capacity = 37;
+    std::uint32_t values[capacity];
+    std::size_t indices[2 * capacity];
+    indexed_priority_view<std::uint32_t, capacity, std::less<std::uint32_t>, Arity> span(values, indices);
+    std::uint32_t expect[capacity];
+    bool present[capacity] = {};
+
+    // Linear congruential generator for reproducible sequence
+    std::uint32_t seed = 1;
+    for (int k = 0; k < 5000; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        const std::size_t handle = (seed >> 8) % capacity;
+        const std::uint32_t value = (seed >> 16) % 1000;
+        switch ((seed >> 28) % 4)
+        {
+        case 0:
+            if (present[handle])
+            {
+                span.erase(handle);
+                present[handle] = false;
+            }
+            break;
+        case 1:
+            if (!span.empty())
+            {
+                present[span.top_handle()] = false;
+                span.pop();
+            }
+            break;
+        default:
+            if (present[handle])
+            {
+                span.update(handle, value);
+            }
+            else
+            {
+                span.push(handle, value);
+                present[handle] = true;
+            }
+            expect[handle] = value;
+            break;
+        }
+
+        std::size_t count = 0;
+        std::uint32_t largest = 0;
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            BOOST_TEST_EQ(span.contains(i), present[i]);
+            if (present[i])
+            {
+                ++count;
+                BOOST_TEST_EQ(span[i], expect[i]);
+                largest = (expect[i] > largest) ? expect[i] : largest;
+            }
+        }
+        BOOST_TEST_EQ(span.size(), count);
+        if (count > 0)
+        {
+            BOOST_TEST_EQ(span.top(), largest);
+        }
+    }
+}
+
+void run()
+{
+    random_operations<2>();
+    random_operations<3>();
+    random_operations<4>();
+}
+
+} // namespace random_suite
+
+//-----------------------------------------------------------------------------
+
+namespace dijkstra_suite
+{
+
+void shortest_path()
+{
+    constexpr std::size_t nodes = 6;
+    constexpr int inf = std::numeric_limits<int>::max();
+    // Adjacency matrix with zero for missing edges
+    const int weight[nodes][nodes] = {
+        { 0, 7, 9, 0, 0, 14 },
+        { 7, 0, 10, 15, 0, 0 },
+        { 9, 10, 0, 11, 0, 2 },
+        { 0, 15, 11, 0, 6, 0 },
+        { 0, 0, 0, 6, 0, 9 },
+        { 14, 0, 2, 0, 9, 0 }
+    };
+    int distance[nodes];
+    std::size_t indices[2 * nodes];
+    indexed_priority_view<int, nodes, std::greater<int>> frontier(distance, indices);
+    int result[nodes] = { inf, inf, inf, inf, inf, inf };
+
+    frontier.push(0, 0);
+    while (!frontier.empty())
+    {
+        const auto current = frontier.top_handle();
+        result[current] = frontier.top();
+        frontier.pop();
+        for (std::size_t next = 0; next < nodes; ++next)
+        {
+            if (weight[current][next] == 0 || result[next] != inf)
+                continue;
+            const int candidate = result[current] + weight[current][next];
+            if (!frontier.contains(next))
+            {
+                frontier.push(next, candidate);
+            }
+            else if (candidate < frontier[next])
+            {
+                frontier.update(next, candidate);
+            }
+        }
+    }
+    const int expect[] = { 0, 7, 9, 20, 20, 11 };
+    BOOST_TEST_ALL_EQ(std::begin(result), std::end(result), std::begin(expect), std::end(expect));
+}
+
+void run()
+{
+    shortest_path();
+}
+
+} // namespace dijkstra_suite
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    push_suite::run();
+    update_suite::run();
+    random_suite::run();
+    dijkstra_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,374 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <boost/detail/lightweight_test.hpp>
+#include <vista/minmax_priority_view.hpp>
+
+using namespace vista;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_ctor_default()
+{
+    minmax_priority_view<int> span;
+    BOOST_TEST(span.empty());
+    BOOST_TEST(span.full());
+    BOOST_TEST_EQ(span.size(), 0);
+    BOOST_TEST_EQ(span.capacity(), 0);
+}
+
+void api_ctor_array()
+{
+    int array[4] = {};
+    minmax_priority_view<int, 4> span(array);
+    BOOST_TEST(span.empty());
+    BOOST_TEST(!span.full());
+    BOOST_TEST_EQ(span.size(), 0);
+    BOOST_TEST_EQ(span.capacity(), 4);
+}
+
+void api_ctor_iterator()
+{
+    std::array<int, 4> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(span.capacity(), 4);
+}
+
+void api_ctor_bulk()
+{
+    std::array<int, 16> array = { 33, 11, 99, 55, 22, 77, 44, 88, 66, 10 };
+    minmax_priority_view<int> span(array.data(), array.size(), 10);
+    BOOST_TEST_EQ(span.size(), 10);
+    BOOST_TEST_EQ(span.capacity(), 16);
+    const int expect[] = { 10, 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+    for (auto value : expect)
+    {
+        BOOST_TEST_EQ(span.min(), value);
+        span.pop_min();
+    }
+    BOOST_TEST(span.empty());
+}
+
+void api_min_max()
+{
+    std::array<int, 4> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    span.push(22);
+    BOOST_TEST_EQ(span.min(), 22);
+    BOOST_TEST_EQ(span.max(), 22);
+    span.push(11);
+    BOOST_TEST_EQ(span.min(), 11);
+    BOOST_TEST_EQ(span.max(), 22);
+    span.push(33);
+    BOOST_TEST_EQ(span.min(), 11);
+    BOOST_TEST_EQ(span.max(), 33);
+    span.push(0);
+    BOOST_TEST_EQ(span.min(), 0);
+    BOOST_TEST_EQ(span.max(), 33);
+    BOOST_TEST(span.full());
+}
+
+void run()
+{
+    api_ctor_default();
+    api_ctor_array();
+    api_ctor_iterator();
+    api_ctor_bulk();
+    api_min_max();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace pop_suite
+{
+
+void pop_min()
+{
+    std::array<int, 8> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    for (auto value : { 55, 11, 77, 33, 22, 66, 44 })
+    {
+        span.push(value);
+    }
+    const int expect[] = { 11, 22, 33, 44, 55, 66, 77 };
+    for (auto value : expect)
+    {
+        BOOST_TEST_EQ(span.min(), value);
+        BOOST_TEST_EQ(span.max(), 77);
+        span.pop_min();
+    }
+    BOOST_TEST(span.empty());
+}
+
+void pop_max()
+{
+    std::array<int, 8> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    for (auto value : { 55, 11, 77, 33, 22, 66, 44 })
+    {
+        span.push(value);
+    }
+    const int expect[] = { 77, 66, 55, 44, 33, 22, 11 };
+    for (auto value : expect)
+    {
+        BOOST_TEST_EQ(span.max(), value);
+        BOOST_TEST_EQ(span.min(), 11);
+        span.pop_max();
+    }
+    BOOST_TEST(span.empty());
+}
+
+void pop_predicate()
+{
+    std::array<int, 8> array = {};
+    minmax_priority_view<int, dynamic_extent, std::greater<int>> span(array.begin(), array.end());
+    for (auto value : { 55, 11, 77, 33 })
+    {
+        span.push(value);
+    }
+    BOOST_TEST_EQ(span.min(), 77);
+    BOOST_TEST_EQ(span.max(), 11);
+    span.pop_min();
+    BOOST_TEST_EQ(span.min(), 55);
+    span.pop_max();
+    BOOST_TEST_EQ(span.max(), 33);
+}
+
+void run()
+{
+    pop_min();
+    pop_max();
+    pop_predicate();
+}
+
+} // namespace pop_suite
+
+//-----------------------------------------------------------------------------
+
+namespace replace_suite
+{
+
+void replace_min()
+{
+    std::array<int, 8> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    for (auto value : { 55, 11, 77, 33, 22 })
+    {
+        span.push(value);
+    }
+    span.replace_min(99);
+    BOOST_TEST_EQ(span.size(), 5);
+    BOOST_TEST_EQ(span.min(), 22);
+    BOOST_TEST_EQ(span.max(), 99);
+}
+
+void replace_max()
+{
+    std::array<int, 8> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    for (auto value : { 55, 11, 77, 33, 22 })
+    {
+        span.push(value);
+    }
+    span.replace_max(0);
+    BOOST_TEST_EQ(span.size(), 5);
+    BOOST_TEST_EQ(span.min(), 0);
+    BOOST_TEST_EQ(span.max(), 55);
+    span.pop_min();
+    BOOST_TEST_EQ(span.min(), 11);
+}
+
+void pushpop_max_evict()
+{
+    // Bounded order book that keeps the cheapest entries
+    std::array<int, 3> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    span.push(30);
+    span.push(10);
+    span.push(20);
+    BOOST_TEST(span.full());
+    BOOST_TEST_EQ(span.pushpop_max(40), 40);
+    BOOST_TEST_EQ(span.max(), 30);
+    BOOST_TEST_EQ(span.pushpop_max(15), 30);
+    BOOST_TEST_EQ(span.max(), 20);
+    BOOST_TEST_EQ(span.pushpop_max(5), 20);
+    BOOST_TEST_EQ(span.min(), 5);
+    BOOST_TEST_EQ(span.max(), 15);
+    BOOST_TEST_EQ(span.size(), 3);
+}
+
+void pushpop_min_evict()
+{
+    std::array<int, 3> array = {};
+    minmax_priority_view<int> span(array.begin(), array.end());
+    BOOST_TEST_EQ(span.pushpop_min(10), 10);
+    span.push(30);
+    span.push(10);
+    span.push(20);
+    BOOST_TEST_EQ(span.pushpop_min(5), 5);
+    BOOST_TEST_EQ(span.pushpop_min(40), 10);
+    BOOST_TEST_EQ(span.min(), 20);
+    BOOST_TEST_EQ(span.max(), 40);
+}
+
+void run()
+{
+    replace_min();
+    replace_max();
+    pushpop_max_evict();
+    pushpop_min_evict();
+}
+
+} // namespace replace_suite
+
+//-----------------------------------------------------------------------------
+
+namespace random_suite
+{
+
+// Compare against ordered multiset
+
+void random_operations()
+{
+    constexpr std::size_t capacity = 41;
+    std::array<std::uint32_t, capacity> array = {};
+    minmax_priority_view<std::uint32_t, capacity> span(array.begin(), array.end());
+    std::multiset<std::uint32_t> expect;
+
+    // Linear congruential generator for reproducible sequence
+    std::uint32_t seed = 1;
+    for (int k = 0; k < 10000; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        const std::uint32_t value = (seed >> 8) % 100;
+        switch ((seed >> 24) % 6)
+        {
+        case 0:
+            if (!expect.empty())
+            {
+                span.pop_min();
+                expect.erase(expect.begin());
+            }
+            break;
+        case 1:
+            if (!expect.empty())
+            {
+                span.pop_max();
+                expect.erase(std::prev(expect.end()));
+            }
+            break;
+        case 2:
+            if (!expect.empty())
+            {
+                span.replace_min(value);
+                expect.erase(expect.begin());
+                expect.insert(value);
+            }
+            break;
+        case 3:
+            if (!expect.empty())
+            {
+                span.replace_max(value);
+                expect.erase(std::prev(expect.end()));
+                expect.insert(value);
+            }
+            break;
+        case 4:
+            if (span.full())
+            {
+                expect.insert(value);
+                const auto removed = span.pushpop_max(value);
+                BOOST_TEST_EQ(removed, *expect.rbegin());
+                expect.erase(std::prev(expect.end()));
+                break;
+            }
+            span.push(value);
+            expect.insert(value);
+            break;
+        default:
+            if (!span.full())
+            {
+                span.push(value);
+                expect.insert(value);
+            }
+            break;
+        }
+        BOOST_TEST_EQ(span.size(), expect.size());
+        if (!expect.empty())
+        {
+            BOOST_TEST_EQ(span.min(), *expect.begin());
+            BOOST_TEST_EQ(span.max(), *expect.rbegin());
+        }
+    }
+}
+
+void random_bulk()
+{
+    std::uint32_t seed = 1;
+    for (std::size_t size = 0; size < 40; ++size)
+    {
+        std::array<std::uint32_t, 40> array = {};
+        std::multiset<std::uint32_t> expect;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            seed = seed * 1103515245U + 12345U;
+            array[i] = (seed >> 8) % 100;
+            expect.insert(array[i]);
+        }
+        minmax_priority_view<std::uint32_t> span(array.data(), array.size(), size);
+        while (!expect.empty())
+        {
+            BOOST_TEST_EQ(span.min(), *expect.begin());
+            BOOST_TEST_EQ(span.max(), *expect.rbegin());
+            if (expect.size() % 2)
+            {
+                span.pop_max();
+                expect.erase(std::prev(expect.end()));
+            }
+            else
+            {
+                span.pop_min();
+                expect.erase(expect.begin());
+            }
+        }
+        BOOST_TEST(span.empty());
+    }
+}
+
+void run()
+{
+    random_operations();
+    random_bulk();
+}
+
+} // namespace random_suite
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    pop_suite::run();
+    replace_suite::run();
+    random_suite::run();
+
+    return boost::report_errors();
+}
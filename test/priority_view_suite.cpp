@@ -8,7 +8,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
 #include <boost/detail/lightweight_test.hpp>
 #include <vista/priority_view.hpp>
 
@@ -654,12 +659,316 @@ void run()
 
 //-----------------------------------------------------------------------------
 
+namespace arity_suite
+{
+
+template <std::size_t Arity>
+void push_pop_sequence()
+{
+    static_assert(priority_view<int, 64, std::less<int>, Arity>::arity == Arity, "");
+
+    std::array<int, 64> array = {};
+    priority_view<int, 64, std::less<int>, Arity> span(array.begin(), array.end());
+    // Linear congruential generator for reproducible input
+    std::uint32_t seed = 1;
+    std::array<int, 64> expect = {};
+    for (auto& value : expect)
+    {
+        seed = seed * 1103515245U + 12345U;
+        value = int(seed >> 16) % 100;
+        span.push(value);
+    }
+    BOOST_TEST(span.full());
+    std::sort(expect.begin(), expect.end(), std::greater<int>());
+    for (auto value : expect)
+    {
+        BOOST_TEST_EQ(span.top(), value);
+        span.pop();
+    }
+    BOOST_TEST(span.empty());
+}
+
+void run()
+{
+    push_pop_sequence<2>();
+    push_pop_sequence<3>();
+    push_pop_sequence<4>();
+    push_pop_sequence<8>();
+}
+
+} // namespace arity_suite
+
+//-----------------------------------------------------------------------------
+
+namespace bulk_suite
+{
+
+void bulk_ctor()
+{
+    std::array<int, 8> array = { 33, 11, 55, 22, 44 };
+    priority_view<int> span(array.data(), array.size(), 5);
+    BOOST_TEST_EQ(span.size(), 5);
+    BOOST_TEST_EQ(span.capacity(), 8);
+    BOOST_TEST(std::is_heap(array.begin(), array.begin() + 5));
+    BOOST_TEST_EQ(span.top(), 55);
+    span.push(66);
+    BOOST_TEST_EQ(span.top(), 66);
+    span.pop();
+    span.pop();
+    BOOST_TEST_EQ(span.top(), 44);
+}
+
+void bulk_ctor_empty()
+{
+    std::array<int, 4> array = {};
+    priority_view<int, 4> span(array.data(), array.size(), 0);
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(span.capacity(), 4);
+}
+
+void push_range_small()
+{
+    std::array<int, 16> array = { 88, 77, 66, 55, 44, 33, 22, 11 };
+    priority_view<int> span(array.data(), array.size(), 8);
+    const int input[] = { 99, 10 };
+    span.push(std::begin(input), std::end(input));
+    BOOST_TEST_EQ(span.size(), 10);
+    BOOST_TEST(std::is_heap(array.begin(), array.begin() + 10));
+    BOOST_TEST_EQ(span.top(), 99);
+}
+
+void push_range_large()
+{
+    std::array<int, 16> array = { 44, 33 };
+    priority_view<int> span(array.data(), array.size(), 2);
+    const std::array<int, 8> input = { 11, 99, 22, 88, 55, 77, 66, 10 };
+    span.push(input.begin(), input.end());
+    BOOST_TEST_EQ(span.size(), 10);
+    BOOST_TEST(std::is_heap(array.begin(), array.begin() + 10));
+    const int expect[] = { 99, 88, 77, 66, 55, 44, 33, 22, 11, 10 };
+    for (auto value : expect)
+    {
+        BOOST_TEST_EQ(span.top(), value);
+        span.pop();
+    }
+    BOOST_TEST(span.empty());
+}
+
+void push_range_arity()
+{
+    std::array<int, 16> array = {};
+    priority_view<int, 16, std::greater<int>, 4> span(array.begin(), array.end());
+    const std::array<int, 8> input = { 11, 99, 22, 88, 55, 77, 66, 10 };
+    span.push(input.begin(), input.end());
+    BOOST_TEST((vista::is_heap<4>(array.begin(), array.begin() + 8, std::greater<int>{})));
+    BOOST_TEST_EQ(span.top(), 10);
+}
+
+void run()
+{
+    bulk_ctor();
+    bulk_ctor_empty();
+    push_range_small();
+    push_range_large();
+    push_range_arity();
+}
+
+} // namespace bulk_suite
+
+//-----------------------------------------------------------------------------
+
+namespace replace_suite
+{
+
+void replace_top()
+{
+    std::array<int, 4> array = {};
+    priority_view<int> span(array.begin(), array.end());
+    span.push(11);
+    span.push(33);
+    span.push(22);
+    span.replace_top(44);
+    BOOST_TEST_EQ(span.size(), 3);
+    BOOST_TEST_EQ(span.top(), 44);
+    span.replace_top(0);
+    BOOST_TEST_EQ(span.size(), 3);
+    BOOST_TEST_EQ(span.top(), 22);
+    span.pop();
+    BOOST_TEST_EQ(span.top(), 11);
+    span.pop();
+    BOOST_TEST_EQ(span.top(), 0);
+}
+
+void replace_top_arity()
+{
+    std::array<int, 16> array = {};
+    priority_view<int, 16, std::greater<int>, 4> span(array.begin(), array.end());
+    const std::array<int, 8> input = { 11, 99, 22, 88, 55, 77, 66, 10 };
+    span.push(input.begin(), input.end());
+    span.replace_top(60);
+    BOOST_TEST((vista::is_heap<4>(array.begin(), array.begin() + 8, std::greater<int>{})));
+    const int expect[] = { 11, 22, 55, 60, 66, 77, 88, 99 };
+    for (auto value : expect)
+    {
+        BOOST_TEST_EQ(span.top(), value);
+        span.pop();
+    }
+}
+
+void pushpop_empty()
+{
+    std::array<int, 4> array = {};
+    priority_view<int> span(array.begin(), array.end());
+    BOOST_TEST_EQ(span.pushpop(11), 11);
+    BOOST_TEST(span.empty());
+}
+
+void pushpop_full()
+{
+    std::array<int, 3> array = {};
+    priority_view<int> span(array.begin(), array.end());
+    span.push(11);
+    span.push(33);
+    span.push(22);
+    BOOST_TEST(span.full());
+    // Input would become the topmost element
+    BOOST_TEST_EQ(span.pushpop(44), 44);
+    BOOST_TEST_EQ(span.top(), 33);
+    BOOST_TEST_EQ(span.pushpop(0), 33);
+    BOOST_TEST_EQ(span.size(), 3);
+    BOOST_TEST_EQ(span.top(), 22);
+    BOOST_TEST_EQ(span.pushpop(22), 22);
+    BOOST_TEST_EQ(span.top(), 22);
+}
+
+void run()
+{
+    replace_top();
+    replace_top_arity();
+    pushpop_empty();
+    pushpop_full();
+}
+
+} // namespace replace_suite
+
+//-----------------------------------------------------------------------------
+
+namespace drain_suite
+{
+
+void drain_sorted()
+{
+    std::array<int, 8> array = {};
+    priority_view<int> span(array.begin(), array.end());
+    const std::array<int, 6> input = { 33, 11, 66, 22, 55, 44 };
+    span.push(input.begin(), input.end());
+    auto sorted = span.drain_sorted();
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(sorted.size(), 6);
+    BOOST_TEST_EQ(sorted.data(), array.data());
+    const int expect[] = { 66, 55, 44, 33, 22, 11 };
+    BOOST_TEST_ALL_EQ(sorted.begin(), sorted.end(), std::begin(expect), std::end(expect));
+    // Storage is reused
+    span.push(77);
+    BOOST_TEST_EQ(span.size(), 1);
+    BOOST_TEST_EQ(span.top(), 77);
+}
+
+void drain_sorted_empty()
+{
+    std::array<int, 4> array = {};
+    priority_view<int> span(array.begin(), array.end());
+    auto sorted = span.drain_sorted();
+    BOOST_TEST(sorted.empty());
+    BOOST_TEST(span.empty());
+}
+
+void drain_sorted_odd()
+{
+    std::array<int, 8> array = {};
+    priority_view<int> span(array.begin(), array.end());
+    const std::array<int, 5> input = { 33, 11, 55, 22, 44 };
+    span.push(input.begin(), input.end());
+    auto sorted = span.drain_sorted();
+    BOOST_TEST(span.empty());
+    const int expect[] = { 55, 44, 33, 22, 11 };
+    BOOST_TEST_ALL_EQ(sorted.begin(), sorted.end(), std::begin(expect), std::end(expect));
+}
+
+void drain_sorted_arity()
+{
+    std::array<int, 64> array = {};
+    priority_view<int, 64, std::greater<int>, 4> span(array.begin(), array.end());
+    for (int k = 0; k < 50; ++k)
+    {
+        span.push((k * 37) % 50);
+    }
+    auto sorted = span.drain_sorted();
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(sorted.size(), 50);
+    for (int k = 0; k < 50; ++k)
+    {
+        BOOST_TEST_EQ(sorted[k], k);
+    }
+}
+
+void pop_n()
+{
+    std::array<int, 8> array = {};
+    priority_view<int> span(array.begin(), array.end());
+    const std::array<int, 6> input = { 33, 11, 66, 22, 55, 44 };
+    span.push(input.begin(), input.end());
+    std::array<int, 3> output = {};
+    auto where = span.pop_n(3, output.begin());
+    BOOST_TEST(where == output.end());
+    const int expect[] = { 66, 55, 44 };
+    BOOST_TEST_ALL_EQ(output.begin(), output.end(), std::begin(expect), std::end(expect));
+    BOOST_TEST_EQ(span.size(), 3);
+    BOOST_TEST_EQ(span.top(), 33);
+    // Remaining elements are still a heap
+    span.push(40);
+    BOOST_TEST_EQ(span.top(), 40);
+}
+
+void pop_n_all()
+{
+    std::array<int, 16> array = {};
+    priority_view<int, 16, std::greater<int>, 3> span(array.begin(), array.end());
+    const std::array<int, 10> input = { 9, 3, 7, 1, 8, 2, 6, 0, 5, 4 };
+    span.push(input.begin(), input.end());
+    std::vector<int> output;
+    span.pop_n(0, std::back_inserter(output));
+    BOOST_TEST(output.empty());
+    span.pop_n(span.size(), std::back_inserter(output));
+    BOOST_TEST(span.empty());
+    const int expect[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    BOOST_TEST_ALL_EQ(output.begin(), output.end(), std::begin(expect), std::end(expect));
+}
+
+void run()
+{
+    drain_sorted();
+    drain_sorted_empty();
+    drain_sorted_odd();
+    drain_sorted_arity();
+    pop_n();
+    pop_n_all();
+}
+
+} // namespace drain_suite
+
+//-----------------------------------------------------------------------------
+
 int main()
 {
     api_dynamic_suite::run();
     api_fixed_suite::run();
     push_suite::run();
     pop_suite::run();
+    arity_suite::run();
+    bulk_suite::run();
+    replace_suite::run();
+    drain_suite::run();
  
     return boost::report_errors();
 }
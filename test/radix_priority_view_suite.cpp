@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <vector>
+#include <boost/detail/lightweight_test.hpp>
+#include <vista/radix_priority_view.hpp>
+
+using namespace vista;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_ctor_default()
+{
+    radix_priority_view<std::uint32_t, int> span;
+    BOOST_TEST(span.empty());
+    BOOST_TEST(span.full());
+    BOOST_TEST_EQ(span.size(), 0);
+    BOOST_TEST_EQ(span.capacity(), 0);
+}
+
+void api_ctor_array()
+{
+    using view_type = radix_priority_view<std::uint32_t, int, 4>;
+    view_type::node_type array[4];
+    view_type span(array);
+    BOOST_TEST(span.empty());
+    BOOST_TEST(!span.full());
+    BOOST_TEST_EQ(span.size(), 0);
+    BOOST_TEST_EQ(span.capacity(), 4);
+}
+
+void api_ctor_pointer()
+{
+    using view_type = radix_priority_view<std::uint64_t, int>;
+    std::vector<view_type::node_type> storage(4);
+    view_type span(storage.data(), storage.size());
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(span.capacity(), 4);
+}
+
+void api_bucket_count()
+{
+    BOOST_TEST_EQ((radix_priority_view<std::uint8_t, int>::bucket_count), 9);
+    BOOST_TEST_EQ((radix_priority_view<std::uint32_t, int>::bucket_count), 33);
+    BOOST_TEST_EQ((radix_priority_view<std::uint64_t, int>::bucket_count), 65);
+}
+
+void api_full()
+{
+    using view_type = radix_priority_view<std::uint32_t, int>;
+    view_type::node_type array[2];
+    view_type span(array);
+    span.push(11, 1);
+    span.push(22, 2);
+    BOOST_TEST(span.full());
+    span.pop();
+    BOOST_TEST(!span.full());
+    // Removed node is reused
+    span.push(33, 3);
+    BOOST_TEST(span.full());
+    BOOST_TEST_EQ(span.top().first, 22);
+}
+
+void api_clear()
+{
+    using view_type = radix_priority_view<std::uint32_t, int>;
+    view_type::node_type array[2];
+    view_type span(array);
+    span.push(11, 1);
+    span.push(22, 2);
+    span.clear();
+    BOOST_TEST(span.empty());
+    span.push(5, 5);
+    span.push(7, 7);
+    BOOST_TEST_EQ(span.top().first, 5);
+}
+
+void run()
+{
+    api_ctor_default();
+    api_ctor_array();
+    api_ctor_pointer();
+    api_bucket_count();
+    api_full();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace pop_suite
+{
+
+void pop_increasing()
+{
+    using view_type = radix_priority_view<std::uint32_t, char>;
+    view_type::node_type array[8];
+    view_type span(array);
+    span.push(10, 'a');
+    span.push(20, 'b');
+    span.push(30, 'c');
+    BOOST_TEST_EQ(span.top().first, 10);
+    BOOST_TEST_EQ(span.top().second, 'a');
+    span.pop();
+    BOOST_TEST_EQ(span.top().first, 20);
+    BOOST_TEST_EQ(span.top().second, 'b');
+    span.pop();
+    BOOST_TEST_EQ(span.top().first, 30);
+    BOOST_TEST_EQ(span.top().second, 'c');
+    span.pop();
+    BOOST_TEST(span.empty());
+}
+
+void pop_decreasing()
+{
+    using view_type = radix_priority_view<std::uint32_t, char>;
+    view_type::node_type array[8];
+    view_type span(array);
+    span.push(30, 'c');
+    BOOST_TEST_EQ(span.lower_bound(), 30);
+    span.pop();
+    BOOST_TEST_EQ(span.lower_bound(), 30);
+    // Empty view accepts any key
+    span.push(20, 'b');
+    span.push(25, 'x');
+    BOOST_TEST_EQ(span.lower_bound(), 20);
+    span.pop();
+    // Keys between the last removed key and the smallest key are accepted
+    BOOST_TEST_EQ(span.lower_bound(), 20);
+    span.push(21, 'y');
+    BOOST_TEST_EQ(span.top().second, 'y');
+    span.pop();
+    BOOST_TEST_EQ(span.lower_bound(), 21);
+    BOOST_TEST_EQ(span.top().second, 'x');
+}
+
+void pop_duplicates()
+{
+    using view_type = radix_priority_view<std::uint32_t, int>;
+    view_type::node_type array[8];
+    view_type span(array);
+    span.push(5, 1);
+    span.push(9, 2);
+    span.push(5, 3);
+    span.push(9, 4);
+    BOOST_TEST_EQ(span.top().first, 5);
+    span.pop();
+    BOOST_TEST_EQ(span.top().first, 5);
+    span.pop();
+    BOOST_TEST_EQ(span.top().first, 9);
+    span.pop();
+    BOOST_TEST_EQ(span.top().first, 9);
+    span.pop();
+    BOOST_TEST(span.empty());
+}
+
+void pop_extreme_keys()
+{
+    using view_type = radix_priority_view<std::uint64_t, int>;
+    view_type::node_type array[4];
+    view_type span(array);
+    span.push(0, 1);
+    span.push(~std::uint64_t(0), 2);
+    span.push(std::uint64_t(1) << 63, 3);
+    BOOST_TEST_EQ(span.top().second, 1);
+    span.pop();
+    BOOST_TEST_EQ(span.top().second, 3);
+    span.pop();
+    BOOST_TEST_EQ(span.top().second, 2);
+    span.pop();
+    BOOST_TEST(span.empty());
+}
+
+void run()
+{
+    pop_increasing();
+    pop_decreasing();
+    pop_duplicates();
+    pop_extreme_keys();
+}
+
+} // namespace pop_suite
+
+//-----------------------------------------------------------------------------
+
+namespace random_suite
+{
+
+// Compare against std::priority_queue with monotone keys
+
+template <typename Key>
+void random_monotone()
+{
+    using view_type = radix_priority_view<Key, std::uint32_t>;
+    std::vector<typename view_type::node_type> storage(64);
+    view_type span(storage.data(), storage.size());
+    std::priority_queue<Key, std::vector<Key>, std::greater<Key>> expect;
+
+    // Linear congruential generator for reproducible sequence
+    std::uint32_t seed = 1;
+    Key now = 0;
+    for (int k = 0; k < 20000; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        if (((seed >> 16) % 3 != 0) && !span.full())
+        {
+            // Saturate at the largest key
+            const std::uint64_t room = std::numeric_limits<Key>::max() - now;
+            const Key key = now + Key(std::min<std::uint64_t>((seed >> 8) % 300, room));
+            span.push(key, seed);
+            expect.push(key);
+        }
+        else if (!span.empty())
+        {
+            BOOST_TEST_EQ(span.top().first, expect.top());
+            now = span.top().first;
+            span.pop();
+            expect.pop();
+        }
+        BOOST_TEST_EQ(span.size(), expect.size());
+        if (!expect.empty())
+        {
+            BOOST_TEST_EQ(span.top().first, expect.top());
+        }
+    }
+}
+
+void run()
+{
+    random_monotone<std::uint8_t>();
+    random_monotone<std::uint16_t>();
+    random_monotone<std::uint32_t>();
+    random_monotone<std::uint64_t>();
+}
+
+} // namespace random_suite
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    pop_suite::run();
+    random_suite::run();
+
+    return boost::report_errors();
+}
@@ -209,10 +209,78 @@ void run()
 
 //-----------------------------------------------------------------------------
 
+namespace api_strided_suite
+{
+
+VISTA_CXX14_CONSTEXPR
+void strided_operator_index()
+{
+    constexpr vista::strided_span<const int, 2, 2> span(data::increasing, 2);
+    static_assert(span.size() == 2, "");
+    static_assert(span.stride() == 2, "");
+    static_assert(span[0] == 11, "");
+    static_assert(span[1] == 33, "");
+    static_assert(span.back() == 33, "");
+}
+
+VISTA_CXX14_CONSTEXPR
+void strided_subspan()
+{
+    constexpr vista::strided_span<const int> span(data::increasing, 2, 2);
+    constexpr auto subspan = span.subspan<1>();
+    static_assert(subspan.size() == 1, "");
+    static_assert(subspan.front() == 33, "");
+}
+
+VISTA_CXX14_CONSTEXPR
+void run()
+{
+    strided_operator_index();
+    strided_subspan();
+}
+
+} // namespace api_strided_suite
+
+//-----------------------------------------------------------------------------
+
+namespace api_matrix_suite
+{
+
+VISTA_CXX14_CONSTEXPR
+void matrix_operator_call()
+{
+    constexpr vista::matrix_span<const int, 2, 2> matrix(data::increasing);
+    static_assert(matrix.size() == 4, "");
+    static_assert(matrix(0, 1) == 22, "");
+    static_assert(matrix(1, 0) == 33, "");
+}
+
+VISTA_CXX14_CONSTEXPR
+void matrix_column()
+{
+    constexpr vista::matrix_span<const int, 2, 2> matrix(data::increasing);
+    constexpr auto column = matrix.column(1);
+    static_assert(column.size() == 2, "");
+    static_assert(column[1] == 44, "");
+}
+
+VISTA_CXX14_CONSTEXPR
+void run()
+{
+    matrix_operator_call();
+    matrix_column();
+}
+
+} // namespace api_matrix_suite
+
+//-----------------------------------------------------------------------------
+
 int main()
 {
     api_dynamic_suite::run();
     api_fixed_suite::run();
+    api_strided_suite::run();
+    api_matrix_suite::run();
 
     return 0;
 }
@@ -593,6 +593,334 @@ void run()
 
 } // namespace api_fixed_suite
 
+//-----------------------------------------------------------------------------
+
+namespace api_strided_suite
+{
+
+void strided_ctor_default()
+{
+    vista::strided_span<int> span;
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(span.size(), 0);
+    BOOST_TEST_EQ(span.stride(), 1);
+}
+
+void strided_ctor_fixed()
+{
+    static_assert(sizeof(vista::strided_span<int, 4, 2>) == sizeof(int *), "fixed extent and stride must not be stored");
+    static_assert(sizeof(vista::strided_span<int, vista::dynamic_extent, 2>) == sizeof(int *) + sizeof(std::size_t), "fixed stride must not be stored");
+
+    int array[8] = { 11, 22, 33, 44, 55, 66, 77, 88 };
+    vista::strided_span<int, 4, 2> span(array, 4);
+    BOOST_TEST_EQ(span.size(), 4);
+    BOOST_TEST_EQ(span.stride(), 2);
+    BOOST_TEST_EQ(span[0], 11);
+    BOOST_TEST_EQ(span[1], 33);
+    BOOST_TEST_EQ(span[2], 55);
+    BOOST_TEST_EQ(span[3], 77);
+}
+
+void strided_ctor_dynamic()
+{
+    int array[6] = { 11, 22, 33, 44, 55, 66 };
+    vista::strided_span<int> span(&array[1], 2, 3);
+    BOOST_TEST_EQ(span.size(), 2);
+    BOOST_TEST_EQ(span.stride(), 3);
+    BOOST_TEST_EQ(span.front(), 22);
+    BOOST_TEST_EQ(span.back(), 55);
+}
+
+void strided_ctor_convertible()
+{
+    int array[8] = { 11, 22, 33, 44, 55, 66, 77, 88 };
+    vista::strided_span<int, 4, 2> span(array, 4);
+    vista::strided_span<const int> clone(span);
+    BOOST_TEST_EQ(clone.size(), 4);
+    BOOST_TEST_EQ(clone.stride(), 2);
+    BOOST_TEST_EQ(clone[3], 77);
+}
+
+void strided_ctor_span()
+{
+    int array[4] = { 11, 22, 33, 44 };
+    vista::span<int, 4> contiguous(array);
+    vista::strided_span<int> span(contiguous);
+    BOOST_TEST_EQ(span.size(), 4);
+    BOOST_TEST_EQ(span.stride(), 1);
+    BOOST_TEST_EQ(span[2], 33);
+}
+
+void strided_interleaved()
+{
+    // Stereo samples with left and right channels interleaved
+    int array[8] = { 1, -1, 2, -2, 3, -3, 4, -4 };
+    vista::strided_span<int, vista::dynamic_extent, 2> left(&array[0], 4);
+    vista::strided_span<int, vista::dynamic_extent, 2> right(&array[1], 4);
+    int expect = 1;
+    for (auto value : left)
+    {
+        BOOST_TEST_EQ(value, expect++);
+    }
+    expect = -1;
+    for (auto value : right)
+    {
+        BOOST_TEST_EQ(value, expect--);
+    }
+    right[3] = 0;
+    BOOST_TEST_EQ(array[7], 0);
+}
+
+void strided_iterator()
+{
+    int array[9] = { 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+    vista::strided_span<int> span(array, 3, 3);
+    auto where = span.begin();
+    BOOST_TEST_EQ(*where, 11);
+    ++where;
+    BOOST_TEST_EQ(*where, 44);
+    where += 1;
+    BOOST_TEST_EQ(*where, 77);
+    BOOST_TEST_EQ(where[-2], 11);
+    BOOST_TEST_EQ(where - span.begin(), 2);
+    BOOST_TEST(++where == span.end());
+    BOOST_TEST(span.begin() < span.end());
+    BOOST_TEST_EQ(span.end() - span.begin(), 3);
+    vista::strided_span<int>::const_iterator other = span.begin();
+    BOOST_TEST_EQ(*(other + 1), 44);
+    BOOST_TEST_EQ(*(span.cend() - 1), 77);
+}
+
+void strided_subspan()
+{
+    int array[8] = { 11, 22, 33, 44, 55, 66, 77, 88 };
+    vista::strided_span<int, 4, 2> span(array, 4);
+    auto tail = span.subspan<1>();
+    BOOST_TEST_EQ(tail.size(), 3);
+    BOOST_TEST_EQ(tail.stride(), 2);
+    BOOST_TEST_EQ(tail[0], 33);
+    auto middle = span.subspan<1, 2>();
+    static_assert(sizeof(middle) == sizeof(int *), "subspan must have fixed extent and stride");
+    BOOST_TEST_EQ(middle.size(), 2);
+    BOOST_TEST_EQ(middle[1], 55);
+    auto none = span.subspan<4>();
+    BOOST_TEST(none.empty());
+}
+
+void run()
+{
+    strided_ctor_default();
+    strided_ctor_fixed();
+    strided_ctor_dynamic();
+    strided_ctor_convertible();
+    strided_ctor_span();
+    strided_interleaved();
+    strided_iterator();
+    strided_subspan();
+}
+
+} // namespace api_strided_suite
+
+//-----------------------------------------------------------------------------
+
+namespace api_matrix_suite
+{
+
+void matrix_ctor_fixed()
+{
+    static_assert(sizeof(vista::matrix_span<int, 2, 3>) == sizeof(int *), "fixed extents must not be stored");
+
+    int array[6] = { 11, 12, 13, 21, 22, 23 };
+    vista::matrix_span<int, 2, 3> matrix(array);
+    BOOST_TEST(!matrix.empty());
+    BOOST_TEST_EQ(matrix.size(), 6);
+    BOOST_TEST_EQ(matrix.rows(), 2);
+    BOOST_TEST_EQ(matrix.columns(), 3);
+    BOOST_TEST_EQ(matrix.row_stride(), 3);
+    BOOST_TEST_EQ(matrix(0, 0), 11);
+    BOOST_TEST_EQ(matrix(1, 2), 23);
+}
+
+void matrix_ctor_dynamic()
+{
+    int array[6] = { 11, 12, 13, 21, 22, 23 };
+    vista::matrix_span<int> matrix(array, 3, 2);
+    BOOST_TEST_EQ(matrix.rows(), 3);
+    BOOST_TEST_EQ(matrix.columns(), 2);
+    BOOST_TEST_EQ(matrix.row_stride(), 2);
+    BOOST_TEST_EQ(matrix(2, 0), 22);
+
+    vista::matrix_span<int> padded(array, 2, 2, 3);
+    BOOST_TEST_EQ(padded.size(), 4);
+    BOOST_TEST_EQ(padded.row_stride(), 3);
+    BOOST_TEST_EQ(padded(1, 1), 22);
+}
+
+void matrix_row()
+{
+    int array[6] = { 11, 12, 13, 21, 22, 23 };
+    vista::matrix_span<int, 2, 3> matrix(array);
+    auto row = matrix.row(1);
+    static_assert(std::is_same<decltype(row), vista::span<int, 3>>::value, "row must have fixed extent");
+    BOOST_TEST_EQ(row.size(), 3);
+    BOOST_TEST_EQ(row[0], 21);
+    BOOST_TEST_EQ(row[2], 23);
+}
+
+void matrix_column()
+{
+    int array[6] = { 11, 12, 13, 21, 22, 23 };
+    vista::matrix_span<int, 2, 3> matrix(array);
+    auto column = matrix.column(2);
+    static_assert(std::is_same<decltype(column), vista::strided_span<int, 2, 3>>::value, "column must have fixed extent and stride");
+    BOOST_TEST_EQ(column.size(), 2);
+    BOOST_TEST_EQ(column[0], 13);
+    BOOST_TEST_EQ(column[1], 23);
+    column[1] = 0;
+    BOOST_TEST_EQ(array[5], 0);
+}
+
+void matrix_submatrix()
+{
+    int array[12] = { 11, 12, 13, 14,
+                      21, 22, 23, 24,
+                      31, 32, 33, 34 };
+    vista::matrix_span<int, 3, 4> matrix(array);
+    auto fixed = matrix.submatrix<1, 1, 2, 2>();
+    static_assert(sizeof(fixed) == sizeof(int *), "submatrix must have fixed extents");
+    BOOST_TEST_EQ(fixed.rows(), 2);
+    BOOST_TEST_EQ(fixed.columns(), 2);
+    BOOST_TEST_EQ(fixed.row_stride(), 4);
+    BOOST_TEST_EQ(fixed(0, 0), 22);
+    BOOST_TEST_EQ(fixed(1, 1), 33);
+    BOOST_TEST_EQ(fixed.column(1)[1], 33);
+
+    auto rest = matrix.submatrix<1, 2>();
+    BOOST_TEST_EQ(rest.rows(), 2);
+    BOOST_TEST_EQ(rest.columns(), 2);
+    BOOST_TEST_EQ(rest(1, 1), 34);
+
+    auto dynamic = matrix.submatrix(0, 1, 3, 3);
+    BOOST_TEST_EQ(dynamic.rows(), 3);
+    BOOST_TEST_EQ(dynamic.columns(), 3);
+    BOOST_TEST_EQ(dynamic(2, 0), 32);
+    BOOST_TEST_EQ(dynamic.row(2)[2], 34);
+}
+
+void run()
+{
+    matrix_ctor_fixed();
+    matrix_ctor_dynamic();
+    matrix_row();
+    matrix_column();
+    matrix_submatrix();
+}
+
+} // namespace api_matrix_suite
+
+//-----------------------------------------------------------------------------
+
+namespace api_aligned_suite
+{
+
+void aligned_ctor_default()
+{
+    vista::aligned_span<float, vista::dynamic_extent, 32> span;
+    BOOST_TEST(span.empty());
+    BOOST_TEST_EQ(span.size(), 0);
+}
+
+void aligned_ctor_array()
+{
+    static_assert(sizeof(vista::aligned_span<float, 8, 32>) == sizeof(float *), "fixed extent must not be stored");
+
+    alignas(32) float array[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    vista::aligned_span<float, 8, 32> span(array);
+    BOOST_TEST_EQ(span.alignment, 32);
+    BOOST_TEST_EQ(span.size(), 8);
+    BOOST_TEST_EQ(span.data(), array);
+    BOOST_TEST_EQ(span.front(), 1);
+    BOOST_TEST_EQ(span.back(), 8);
+    BOOST_TEST_EQ(span[2], 3);
+}
+
+void aligned_ctor_pointer_size()
+{
+    alignas(16) int array[4] = { 11, 22, 33, 44 };
+    vista::aligned_span<int, vista::dynamic_extent, 16> span(array, 4);
+    BOOST_TEST_EQ(span.size(), 4);
+    vista::aligned_span<int, vista::dynamic_extent, 16> other(&array[0], &array[4]);
+    BOOST_TEST_EQ(other.size(), 4);
+}
+
+void aligned_ctor_span()
+{
+    int array[4] = { 11, 22, 33, 44 };
+    vista::span<int> contiguous(array);
+    // Natural alignment is provable
+    vista::aligned_span<int> natural = contiguous;
+    BOOST_TEST_EQ(natural.size(), 4);
+    BOOST_TEST_EQ(natural.alignment, alignof(int));
+
+    alignas(16) int aligned[4] = { 11, 22, 33, 44 };
+    static_assert(!std::is_convertible<vista::span<int>, vista::aligned_span<int, vista::dynamic_extent, 16>>::value, "stricter alignment must be explicit");
+    vista::aligned_span<int, vista::dynamic_extent, 16> strict(vista::span<int>{aligned});
+    BOOST_TEST_EQ(strict[3], 44);
+}
+
+void aligned_ctor_convertible()
+{
+    alignas(32) int array[8] = {};
+    vista::aligned_span<int, 8, 32> span(array);
+    vista::aligned_span<const int, vista::dynamic_extent, 16> clone = span;
+    BOOST_TEST_EQ(clone.size(), 8);
+    BOOST_TEST_EQ(clone.data(), array);
+    static_assert(!std::is_convertible<vista::aligned_span<int, 8, 16>, vista::aligned_span<int, 8, 32>>::value, "alignment must not be weakened");
+}
+
+void aligned_subspan()
+{
+    alignas(32) float array[16] = {};
+    vista::aligned_span<float, 16, 32> span(array);
+    auto full = span.subspan<8>();
+    static_assert(decltype(full)::alignment == 32, "offset of 32 bytes retains alignment");
+    BOOST_TEST_EQ(full.size(), 8);
+    BOOST_TEST_EQ(full.data(), &array[8]);
+    auto half = span.subspan<4, 4>();
+    static_assert(decltype(half)::alignment == 16, "offset of 16 bytes reduces alignment");
+    BOOST_TEST_EQ(half.size(), 4);
+    auto odd = span.subspan<1>();
+    static_assert(decltype(odd)::alignment == alignof(float), "odd offset has natural alignment");
+    BOOST_TEST_EQ(odd.size(), 15);
+}
+
+void aligned_iterator()
+{
+    alignas(32) int array[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    vista::aligned_span<int, vista::dynamic_extent, 32> span(array);
+    int sum = 0;
+    for (auto value : span)
+    {
+        sum += value;
+    }
+    BOOST_TEST_EQ(sum, 36);
+    BOOST_TEST_EQ(span.end() - span.begin(), 8);
+    BOOST_TEST_EQ(span.cend() - span.cbegin(), 8);
+}
+
+void run()
+{
+    aligned_ctor_default();
+    aligned_ctor_array();
+    aligned_ctor_pointer_size();
+    aligned_ctor_span();
+    aligned_ctor_convertible();
+    aligned_subspan();
+    aligned_iterator();
+}
+
+} // namespace api_aligned_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -601,6 +929,9 @@ int main()
 {
     api_dynamic_suite::run();
     api_fixed_suite::run();
+    api_strided_suite::run();
+    api_matrix_suite::run();
+    api_aligned_suite::run();
  
     return boost::report_errors();
 }
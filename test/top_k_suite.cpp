@@ -0,0 +1,213 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2020 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <boost/detail/lightweight_test.hpp>
+#include <vista/top_k.hpp>
+
+using namespace vista;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_ctor_default()
+{
+    top_k<int, 4> data;
+    BOOST_TEST(data.empty());
+    BOOST_TEST(!data.full());
+    BOOST_TEST_EQ(data.size(), 0);
+    BOOST_TEST_EQ(data.capacity(), 4);
+}
+
+void api_ctor_copy()
+{
+    top_k<int, 4> data;
+    data.push(11);
+    data.push(22);
+    top_k<int, 4> copy(data);
+    data.clear();
+    BOOST_TEST_EQ(copy.size(), 2);
+    BOOST_TEST_EQ(copy.threshold(), 11);
+    copy.push(33);
+    BOOST_TEST_EQ(copy.size(), 3);
+    BOOST_TEST(data.empty());
+}
+
+void api_assign_copy()
+{
+    top_k<int, 4> data;
+    data.push(11);
+    data.push(22);
+    top_k<int, 4> copy;
+    copy = data;
+    data.push(0);
+    BOOST_TEST_EQ(copy.size(), 2);
+    BOOST_TEST_EQ(copy.threshold(), 11);
+    BOOST_TEST_EQ(data.threshold(), 0);
+}
+
+void api_clear()
+{
+    top_k<int, 2> data;
+    data.push(11);
+    data.push(22);
+    BOOST_TEST(data.full());
+    data.clear();
+    BOOST_TEST(data.empty());
+    BOOST_TEST(data.push(0));
+}
+
+void run()
+{
+    api_ctor_default();
+    api_ctor_copy();
+    api_assign_copy();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace push_suite
+{
+
+void push_below_capacity()
+{
+    top_k<int, 4> data;
+    BOOST_TEST(data.push(22));
+    BOOST_TEST_EQ(data.threshold(), 22);
+    BOOST_TEST(data.push(33));
+    BOOST_TEST_EQ(data.threshold(), 22);
+    BOOST_TEST(data.push(11));
+    BOOST_TEST_EQ(data.threshold(), 11);
+    BOOST_TEST_EQ(data.size(), 3);
+}
+
+void push_threshold()
+{
+    top_k<int, 3> data;
+    data.push(22);
+    data.push(33);
+    data.push(11);
+    BOOST_TEST(data.full());
+    // Not better than threshold
+    BOOST_TEST(!data.push(0));
+    BOOST_TEST(!data.push(11));
+    BOOST_TEST_EQ(data.threshold(), 11);
+    // Better than threshold
+    BOOST_TEST(data.push(44));
+    BOOST_TEST_EQ(data.threshold(), 22);
+    BOOST_TEST(data.push(25));
+    BOOST_TEST_EQ(data.threshold(), 25);
+    BOOST_TEST_EQ(data.size(), 3);
+}
+
+void push_predicate()
+{
+    top_k<int, 3, std::greater<int>> data;
+    data.push(22);
+    data.push(33);
+    data.push(11);
+    BOOST_TEST_EQ(data.threshold(), 33);
+    BOOST_TEST(!data.push(44));
+    BOOST_TEST(data.push(0));
+    BOOST_TEST_EQ(data.threshold(), 22);
+}
+
+void run()
+{
+    push_below_capacity();
+    push_threshold();
+    push_predicate();
+}
+
+} // namespace push_suite
+
+//-----------------------------------------------------------------------------
+
+namespace sort_suite
+{
+
+void sort_empty()
+{
+    top_k<int, 4> data;
+    auto result = data.sort();
+    BOOST_TEST(result.empty());
+}
+
+void sort_partial()
+{
+    top_k<int, 4> data;
+    data.push(22);
+    data.push(33);
+    data.push(11);
+    auto result = data.sort();
+    BOOST_TEST(data.empty());
+    const int expect[] = { 33, 22, 11 };
+    BOOST_TEST_ALL_EQ(result.begin(), result.end(), std::begin(expect), std::end(expect));
+}
+
+void sort_predicate()
+{
+    top_k<int, 3, std::greater<int>> data;
+    for (int value : { 55, 11, 44, 22, 33 })
+    {
+        data.push(value);
+    }
+    auto result = data.sort();
+    const int expect[] = { 11, 22, 33 };
+    BOOST_TEST_ALL_EQ(result.begin(), result.end(), std::begin(expect), std::end(expect));
+}
+
+void sort_against_vector()
+{
+    // Linear congruential generator for reproducible sequence
+    std::uint32_t seed = 1;
+    top_k<std::uint32_t, 16> data;
+    std::vector<std::uint32_t> expect;
+    for (int k = 0; k < 1000; ++k)
+    {
+        seed = seed * 1103515245U + 12345U;
+        const std::uint32_t value = (seed >> 16) % 512;
+        data.push(value);
+        expect.push_back(value);
+    }
+    std::sort(expect.begin(), expect.end(), std::greater<std::uint32_t>());
+    expect.resize(data.capacity());
+    auto result = data.sort();
+    BOOST_TEST_ALL_EQ(result.begin(), result.end(), expect.begin(), expect.end());
+}
+
+void run()
+{
+    sort_empty();
+    sort_partial();
+    sort_predicate();
+    sort_against_vector();
+}
+
+} // namespace sort_suite
+
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    push_suite::run();
+    sort_suite::run();
+
+    return boost::report_errors();
+}